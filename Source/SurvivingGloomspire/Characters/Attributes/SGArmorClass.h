@@ -22,6 +22,8 @@ struct FSGArmorClass
         , NaturalArmor(0)
         , DeflectionBonus(0)
         , DodgeBonus(0)
+        , bHasMaxDexBonus(false)
+        , MaxDexBonus(0)
     {}
 
     // Base AC values
@@ -50,6 +52,31 @@ struct FSGArmorClass
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Attributes|AC|Bonuses")
     int32 DodgeBonus;
 
+    // Maximum Dexterity bonus allowed by worn armor and shields
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Attributes|AC|Bonuses", meta = (InlineEditConditionToggle))
+    bool bHasMaxDexBonus;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Attributes|AC|Bonuses", meta = (EditCondition = "bHasMaxDexBonus", ClampMin = "0"))
+    int32 MaxDexBonus;
+
+    /** Value used for MaxDexBonus when no armor limits Dexterity */
+    static constexpr int32 NoMaxDexBonus = MAX_int32;
+
+    /** Gets the Dexterity cap in effect, or NoMaxDexBonus */
+    int32 GetMaxDexBonus() const
+    {
+        return bHasMaxDexBonus ? MaxDexBonus : NoMaxDexBonus;
+    }
+
+    /**
+     * Gets the Dexterity bonus that applies to AC after the armor cap
+     * @param DexterityModifier Character's Dexterity modifier
+     */
+    int32 GetDexterityBonus(int32 DexterityModifier) const
+    {
+        return FMath::Min(FMath::Max(0, DexterityModifier), GetMaxDexBonus());
+    }
+
     /**
      * Calculates the total AC based on all bonuses
      * @param DexterityModifier Character's Dexterity modifier
@@ -64,7 +91,7 @@ struct FSGArmorClass
         return Base + 
                ArmorBonus + 
                ShieldBonus + 
-               FMath::Max(0, DexterityModifier) + // Max Dex bonus from armor would be applied here
+               GetDexterityBonus(DexterityModifier) + 
                SizeModifier + 
                NaturalArmor + 
                DeflectionBonus + 
@@ -83,7 +110,7 @@ struct FSGArmorClass
     {
         // Base 10 + Dex modifier + size modifier + deflection + dodge + other modifiers
         return Base + 
-               FMath::Max(0, DexterityModifier) + 
+               GetDexterityBonus(DexterityModifier) + 
                SizeModifier + 
                DeflectionBonus + 
                DodgeBonus + 
@@ -0,0 +1,82 @@
+// Copyright 2025 Surviving Gloomspire Team. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SGAttributeType.h"
+#include "SGAttributeData.h"
+#include "SGAttributeBlock.generated.h"
+
+/**
+ * Fixed-slot storage for the six ability scores.
+ * Each slot is indexed directly by ESGAttributeType, so every lookup is a single indexed load
+ * and the scores and modifiers sit in one contiguous array with no hashing or indirection.
+ */
+USTRUCT(BlueprintType)
+struct FSGAttributeBlock
+{
+    GENERATED_BODY()
+
+    /** Score and modifier for each attribute, indexed by ESGAttributeType */
+    UPROPERTY(EditAnywhere, Category = "Attributes", meta = (ArraySizeEnum = "ESGAttributeType"))
+    FSGAttributeData Values[SGAttributeCount];
+
+    /** Whether an attribute type names a slot; values from Blueprint or serialized data must be checked first */
+    static constexpr bool IsValidType(ESGAttributeType AttributeType)
+    {
+        return AttributeType < ESGAttributeType::MAX;
+    }
+
+    /**
+     * Gets the data for an attribute
+     * @param AttributeType The attribute to read (must not be MAX)
+     */
+    FORCEINLINE const FSGAttributeData& Get(ESGAttributeType AttributeType) const
+    {
+        checkSlow(AttributeType < ESGAttributeType::MAX);
+        return Values[static_cast<uint8>(AttributeType)];
+    }
+
+    /** Gets the base score of an attribute */
+    FORCEINLINE int32 GetScore(ESGAttributeType AttributeType) const
+    {
+        return Get(AttributeType).BaseValue;
+    }
+
+    /** Gets the cached modifier of an attribute */
+    FORCEINLINE int32 GetModifier(ESGAttributeType AttributeType) const
+    {
+        return Get(AttributeType).Modifier;
+    }
+
+    /**
+     * Sets the base score of an attribute and recalculates its modifier
+     * @param AttributeType The attribute to modify (must not be MAX)
+     * @param NewValue The new base value, expected to already be clamped to 1-30
+     * @return True if the stored value changed
+     */
+    bool SetScore(ESGAttributeType AttributeType, int32 NewValue)
+    {
+        checkSlow(AttributeType < ESGAttributeType::MAX);
+        FSGAttributeData& Attribute = Values[static_cast<uint8>(AttributeType)];
+        if (Attribute.BaseValue == NewValue)
+        {
+            return false;
+        }
+
+        Attribute.BaseValue = NewValue;
+        Attribute.CalculateModifier();
+        return true;
+    }
+
+    /** Recalculates the modifier of every attribute from its base value */
+    void RecalculateModifiers()
+    {
+        for (FSGAttributeData& Attribute : Values)
+        {
+            Attribute.CalculateModifier();
+        }
+    }
+};
+
+static_assert(sizeof(FSGAttributeBlock) == sizeof(FSGAttributeData) * SGAttributeCount, "FSGAttributeBlock should hold only the attribute slots");
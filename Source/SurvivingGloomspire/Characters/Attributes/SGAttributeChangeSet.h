@@ -0,0 +1,92 @@
+// Copyright 2025 Surviving Gloomspire Team. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SGAttributeType.h"
+#include "SGAttributeChangeSet.generated.h"
+
+/**
+ * A single attribute score change
+ */
+USTRUCT(BlueprintType)
+struct FSGAttributeChange
+{
+    GENERATED_BODY()
+
+    FSGAttributeChange()
+        : AttributeType(ESGAttributeType::STR)
+        , NewValue(10)
+    {}
+
+    FSGAttributeChange(ESGAttributeType InAttributeType, int32 InNewValue)
+        : AttributeType(InAttributeType)
+        , NewValue(InNewValue)
+    {}
+
+    /** The attribute to change */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Attributes")
+    ESGAttributeType AttributeType;
+
+    /** The new base value (will be clamped between 1-30) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Attributes", meta = (ClampMin = "1", ClampMax = "30"))
+    int32 NewValue;
+};
+
+/**
+ * A batch of attribute, hit point and armor class changes applied in one transaction.
+ * Derived stats are recomputed once and a single change notification is sent when the batch is applied.
+ */
+USTRUCT(BlueprintType)
+struct FSGAttributeChangeSet
+{
+    GENERATED_BODY()
+
+    /** Attribute score changes, applied in order */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Attributes")
+    TArray<FSGAttributeChange> AttributeChanges;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Attributes|HP", meta = (InlineEditConditionToggle))
+    bool bOverrideBaseHitPoints = false;
+
+    /** New base hit points from class and level */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Attributes|HP", meta = (EditCondition = "bOverrideBaseHitPoints"))
+    int32 BaseHitPoints = 0;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Attributes|HP", meta = (InlineEditConditionToggle))
+    bool bOverrideTemporaryHitPoints = false;
+
+    /** New temporary hit points */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Attributes|HP", meta = (EditCondition = "bOverrideTemporaryHitPoints"))
+    int32 TemporaryHitPoints = 0;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Attributes|AC", meta = (InlineEditConditionToggle))
+    bool bOverrideArmorBonuses = false;
+
+    /** New armor bonus to AC */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Attributes|AC", meta = (EditCondition = "bOverrideArmorBonuses"))
+    int32 ArmorBonus = 0;
+
+    /** New shield bonus to AC */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Attributes|AC", meta = (EditCondition = "bOverrideArmorBonuses"))
+    int32 ShieldBonus = 0;
+
+    /** New natural armor bonus to AC */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Attributes|AC", meta = (EditCondition = "bOverrideArmorBonuses"))
+    int32 NaturalArmor = 0;
+
+    /** New deflection bonus to AC */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Attributes|AC", meta = (EditCondition = "bOverrideArmorBonuses"))
+    int32 DeflectionBonus = 0;
+
+    /** New dodge bonus to AC */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Attributes|AC", meta = (EditCondition = "bOverrideArmorBonuses"))
+    int32 DodgeBonus = 0;
+
+    /** Adds an attribute score change to the batch */
+    FSGAttributeChangeSet& SetAttribute(ESGAttributeType AttributeType, int32 NewValue)
+    {
+        AttributeChanges.Emplace(AttributeType, NewValue);
+        return *this;
+    }
+};
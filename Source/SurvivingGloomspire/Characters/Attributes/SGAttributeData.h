@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "SGRulesTables.h"
 #include "SGAttributeData.generated.h"
 
 /**
@@ -25,7 +26,12 @@ struct FSGAttributeData
     /** Default constructor */
     FSGAttributeData() : BaseValue(10), Modifier(0) 
     {
-        UE_LOG(LogTemp, Verbose, TEXT("FSGAttributeData: Created with default values (Base: %d, Modifier: %d)"), BaseValue, Modifier);
+    }
+
+    FSGAttributeData(int32 InBaseValue, int32 InModifier)
+        : BaseValue(InBaseValue)
+        , Modifier(InModifier)
+    {
     }
 
     /**
@@ -34,10 +40,6 @@ struct FSGAttributeData
      */
     void CalculateModifier()
     {
-        const int32 OldModifier = Modifier;
-        Modifier = FMath::FloorToInt((BaseValue - 10) / 2.0f);
-        
-        UE_LOG(LogTemp, Verbose, TEXT("FSGAttributeData: Modifier recalculated. Base: %d, Old Mod: %d, New Mod: %d"), 
-            BaseValue, OldModifier, Modifier);
+        Modifier = SGRules::GetAbilityModifier(BaseValue);
     }
 };
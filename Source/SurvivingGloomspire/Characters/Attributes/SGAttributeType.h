@@ -17,13 +17,14 @@ enum class ESGAttributeType : uint8
     CON  UMETA(DisplayName = "Constitution"),
     INT  UMETA(DisplayName = "Intelligence"),
     WIS  UMETA(DisplayName = "Wisdom"),
-    CHA  UMETA(DisplayName = "Charisma")
+    CHA  UMETA(DisplayName = "Charisma"),
+    
+    // Add MAX at the end for iteration
+    MAX  UMETA(Hidden)
 };
 
-// Helper function to convert enum to string
-static FString GetAttributeTypeAsString(ESGAttributeType AttributeType)
-{
-    const UEnum* EnumPtr = FindObject<UEnum>(nullptr, TEXT("/Script/SurvivingGloomspire.ESGAttributeType"), true);
-    if (!EnumPtr) return FString("Unknown");
-    return EnumPtr->GetNameStringByValue(static_cast<int64>(AttributeType));
-}
+/** Number of attribute slots, used to size enum-indexed attribute arrays */
+constexpr int32 SGAttributeCount = static_cast<int32>(ESGAttributeType::MAX);
+
+// Helper function to convert enum to string, backed by FSGDisplayNames
+SURVIVINGGLOOMSPIRE_API const FString& GetAttributeTypeAsString(ESGAttributeType AttributeType);
@@ -0,0 +1,177 @@
+// Copyright 2025 Surviving Gloomspire Team. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SGAttributeType.h"
+#include "SGSkillType.h"
+#include "SGSavingThrows.h"
+#include "SGRulesTables.h"
+
+/**
+ * Inputs that derived stats are computed from.
+ * The first six entries share their ordinals with ESGAttributeType.
+ */
+enum class ESGDerivedInput : uint8
+{
+    STR,
+    DEX,
+    CON,
+    INT,
+    WIS,
+    CHA,
+    ClassLevels,    // Class levels, base hit points and base saves
+    Feats,          // Owned feats
+    Equipment,      // Armor, shields and other worn bonuses
+
+    MAX
+};
+
+/**
+ * Stats derived from the inputs above.
+ * Skill totals occupy one slot per ESGSkillType starting at FirstSkill.
+ */
+enum class ESGDerivedStat : uint8
+{
+    MaxHitPoints,
+    ArmorClass,
+    TouchArmorClass,
+    FlatFootedArmorClass,
+    Fortitude,
+    Reflex,
+    Will,
+    FirstSkill,
+
+    MAX = FirstSkill + SGSkillCount
+};
+
+static_assert(static_cast<uint8>(ESGDerivedInput::CHA) == static_cast<uint8>(ESGAttributeType::CHA), "Attribute inputs must mirror ESGAttributeType");
+static_assert(static_cast<int32>(ESGDerivedStat::MAX) <= 64, "Derived stat dirty mask must fit in a uint64");
+
+namespace SGDerivedStats
+{
+    constexpr int32 NumStats = static_cast<int32>(ESGDerivedStat::MAX);
+
+    constexpr uint64 Bit(ESGDerivedStat Stat)
+    {
+        return uint64(1) << static_cast<uint8>(Stat);
+    }
+
+    /** Gets the derived stat slot for a skill total */
+    constexpr ESGDerivedStat SkillStat(ESGSkillType SkillType)
+    {
+        return static_cast<ESGDerivedStat>(static_cast<uint8>(ESGDerivedStat::FirstSkill) + static_cast<uint8>(SkillType));
+    }
+
+    /** Gets the derived stat slot for a saving throw total */
+    constexpr ESGDerivedStat SaveStat(ESGSavingThrowType SaveType)
+    {
+        return static_cast<ESGDerivedStat>(static_cast<uint8>(ESGDerivedStat::Fortitude) + static_cast<uint8>(SaveType));
+    }
+
+    constexpr uint64 ArmorClassMask = Bit(ESGDerivedStat::ArmorClass) | Bit(ESGDerivedStat::TouchArmorClass) | Bit(ESGDerivedStat::FlatFootedArmorClass);
+    constexpr uint64 SaveMask = Bit(ESGDerivedStat::Fortitude) | Bit(ESGDerivedStat::Reflex) | Bit(ESGDerivedStat::Will);
+    constexpr uint64 SkillMask = ((uint64(1) << SGSkillCount) - 1) << static_cast<uint8>(ESGDerivedStat::FirstSkill);
+    constexpr uint64 AllMask = (uint64(1) << NumStats) - 1;
+
+    /** Gets the mask of skill totals whose key ability is the given attribute */
+    constexpr uint64 SkillsKeyedOn(ESGAttributeType Attribute)
+    {
+        uint64 Mask = 0;
+        for (int32 Index = 0; Index < SGSkillCount; ++Index)
+        {
+            if (SGRules::SkillKeyAbilityTable[Index] == Attribute)
+            {
+                Mask |= Bit(SkillStat(static_cast<ESGSkillType>(Index)));
+            }
+        }
+        return Mask;
+    }
+
+    /** Skills that take the armor check penalty (every STR- and DEX-based skill) */
+    constexpr uint64 ArmorCheckSkillMask = SkillsKeyedOn(ESGAttributeType::STR) | SkillsKeyedOn(ESGAttributeType::DEX);
+
+    /** Derived stats that depend on each input, indexed by ESGDerivedInput */
+    constexpr uint64 DependencyTable[static_cast<int32>(ESGDerivedInput::MAX)] =
+    {
+        SkillsKeyedOn(ESGAttributeType::STR),
+        SkillsKeyedOn(ESGAttributeType::DEX) | Bit(ESGDerivedStat::ArmorClass) | Bit(ESGDerivedStat::TouchArmorClass) | Bit(ESGDerivedStat::Reflex),
+        SkillsKeyedOn(ESGAttributeType::CON) | Bit(ESGDerivedStat::MaxHitPoints) | Bit(ESGDerivedStat::Fortitude),
+        SkillsKeyedOn(ESGAttributeType::INT),
+        SkillsKeyedOn(ESGAttributeType::WIS) | Bit(ESGDerivedStat::Will),
+        SkillsKeyedOn(ESGAttributeType::CHA),
+        Bit(ESGDerivedStat::MaxHitPoints) | SaveMask | SkillMask,
+        AllMask,
+        ArmorClassMask | SaveMask | ArmorCheckSkillMask
+    };
+
+    /** Gets the derived stats that must be recomputed when an input changes */
+    constexpr uint64 GetDependents(ESGDerivedInput Input)
+    {
+        return DependencyTable[static_cast<uint8>(Input)];
+    }
+
+    static_assert(UE_ARRAY_COUNT(DependencyTable) == static_cast<int32>(ESGDerivedInput::MAX), "DependencyTable must cover every input");
+    static_assert((SkillsKeyedOn(ESGAttributeType::STR) | SkillsKeyedOn(ESGAttributeType::DEX) | SkillsKeyedOn(ESGAttributeType::CON)
+        | SkillsKeyedOn(ESGAttributeType::INT) | SkillsKeyedOn(ESGAttributeType::WIS) | SkillsKeyedOn(ESGAttributeType::CHA)) == SkillMask,
+        "Every skill total must depend on exactly one attribute");
+}
+
+/**
+ * Lazily evaluated cache of derived stats.
+ * Inputs mark only their dependent stats dirty; a dirty stat is recomputed the next time it is read.
+ */
+struct FSGDerivedStats
+{
+    /** Bit per ESGDerivedStat that needs recomputing; everything starts dirty */
+    uint64 DirtyMask = SGDerivedStats::AllMask;
+
+    /** Last computed value of each derived stat */
+    int32 Values[SGDerivedStats::NumStats] = {};
+
+    /** Marks every stat that depends on an input as dirty */
+    FORCEINLINE void Invalidate(ESGDerivedInput Input)
+    {
+        DirtyMask |= SGDerivedStats::GetDependents(Input);
+    }
+
+    /** Marks a single stat as dirty */
+    FORCEINLINE void Invalidate(ESGDerivedStat Stat)
+    {
+        DirtyMask |= SGDerivedStats::Bit(Stat);
+    }
+
+    /** Marks a set of stats as dirty */
+    FORCEINLINE void Invalidate(uint64 StatMask)
+    {
+        DirtyMask |= StatMask;
+    }
+
+    /** Marks every stat as dirty */
+    FORCEINLINE void InvalidateAll()
+    {
+        DirtyMask = SGDerivedStats::AllMask;
+    }
+
+    FORCEINLINE bool IsDirty(ESGDerivedStat Stat) const
+    {
+        return (DirtyMask & SGDerivedStats::Bit(Stat)) != 0;
+    }
+
+    /**
+     * Gets a stat, recomputing it first if it is dirty
+     * @param Stat The stat to read
+     * @param Compute Callable taking the stat and returning its fresh value
+     */
+    template <typename ComputeFunc>
+    FORCEINLINE int32 Resolve(ESGDerivedStat Stat, ComputeFunc&& Compute)
+    {
+        const uint8 Index = static_cast<uint8>(Stat);
+        if (DirtyMask & SGDerivedStats::Bit(Stat))
+        {
+            Values[Index] = Compute(Stat);
+            DirtyMask &= ~SGDerivedStats::Bit(Stat);
+        }
+        return Values[Index];
+    }
+};
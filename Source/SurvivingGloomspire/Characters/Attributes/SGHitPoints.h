@@ -5,6 +5,18 @@
 #include "CoreMinimal.h"
 #include "SGHitPoints.generated.h"
 
+/**
+ * A single damage or healing amount, used when applying several hit point changes at once
+ */
+struct FSGHitPointChange
+{
+    /** Damage or healing amount; non-positive amounts are ignored */
+    int32 Amount = 0;
+
+    /** True for healing, false for damage */
+    bool bIsHealing = false;
+};
+
 /**
  * Structure containing hit point related attributes
  */
@@ -67,4 +79,32 @@ struct FSGHitPoints
         Current += HealAmount;
         return HealAmount;
     }
+
+    /**
+     * Applies a list of damage and healing changes in order
+     * @param Changes The changes to apply
+     * @param OutDamageTaken Total damage taken, including damage absorbed by temporary hit points
+     * @param OutHealed Total healing applied
+     */
+    void ApplyChanges(TConstArrayView<FSGHitPointChange> Changes, int32& OutDamageTaken, int32& OutHealed)
+    {
+        OutDamageTaken = 0;
+        OutHealed = 0;
+        for (const FSGHitPointChange& Change : Changes)
+        {
+            if (Change.Amount <= 0)
+            {
+                continue;
+            }
+            
+            if (Change.bIsHealing)
+            {
+                OutHealed += Heal(Change.Amount);
+            }
+            else
+            {
+                OutDamageTaken += ApplyDamage(Change.Amount);
+            }
+        }
+    }
 };
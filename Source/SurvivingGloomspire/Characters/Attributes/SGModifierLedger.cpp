@@ -0,0 +1,251 @@
+// Copyright 2025 Surviving Gloomspire Team. All Rights Reserved.
+
+#include "SGModifierLedger.h"
+
+FSGModifierHandle FSGModifierLedger::Add(FName Source, ESGBonusType BonusType, int32 Slot, int32 Value)
+{
+    check(Slot >= 0 && Slot < SGModifiers::NumSlots);
+    check(BonusType < ESGBonusType::MAX);
+
+    int32 Index;
+    if (FreeIndices.Num() > 0)
+    {
+        Index = FreeIndices.Pop(EAllowShrinking::No);
+    }
+    else
+    {
+        Index = Entries.AddDefaulted();
+    }
+
+    const uint16 BucketKey = MakeBucketKey(Slot, BonusType);
+
+    FEntry& Entry = Entries[Index];
+    Entry.Source = Source;
+    Entry.Value = Value;
+    Entry.Serial = NextSerial++;
+    Entry.HeapIndex = INDEX_NONE;
+    Entry.BucketKey = BucketKey;
+    Entry.bActive = true;
+
+    EntriesBySource.FindOrAdd(Source).Add(Index);
+
+    FBucket& Bucket = Buckets.FindOrAdd(BucketKey);
+    ++Bucket.NumEntries;
+    if (Value < 0)
+    {
+        Bucket.Penalties += Value;
+    }
+    else if (FBonusHeap* Heap = FindBonusHeap(Bucket, BucketKey, Source))
+    {
+        const int32 OldMax = GetHeapMax(*Heap);
+        HeapPush(*Heap, Index);
+        Bucket.AppliedBonus += GetHeapMax(*Heap) - OldMax;
+    }
+    else
+    {
+        Bucket.AppliedBonus += Value;
+    }
+    CommitBucket(BucketKey, Bucket);
+
+    return FSGModifierHandle(Index, Entry.Serial);
+}
+
+bool FSGModifierLedger::Remove(const FSGModifierHandle& Handle)
+{
+    if (!Entries.IsValidIndex(Handle.Index))
+    {
+        return false;
+    }
+
+    const FEntry& Entry = Entries[Handle.Index];
+    if (!Entry.bActive || Entry.Serial != Handle.Serial)
+    {
+        return false;
+    }
+
+    RemoveEntry(Handle.Index);
+    return true;
+}
+
+int32 FSGModifierLedger::RemoveAllFromSource(FName Source)
+{
+    TArray<int32, TInlineAllocator<4>> SourceEntries;
+    if (!EntriesBySource.RemoveAndCopyValue(Source, SourceEntries))
+    {
+        return 0;
+    }
+
+    for (const int32 Index : SourceEntries)
+    {
+        RemoveEntry(Index);
+    }
+    return SourceEntries.Num();
+}
+
+void FSGModifierLedger::Reset()
+{
+    for (int32 Slot = 0; Slot < SGModifiers::NumSlots; ++Slot)
+    {
+        if (Totals[Slot] != 0)
+        {
+            ChangedSlots |= SGModifiers::SlotBit(Slot);
+        }
+        Totals[Slot] = 0;
+    }
+
+    Entries.Reset();
+    FreeIndices.Reset();
+    Buckets.Reset();
+    EntriesBySource.Reset();
+}
+
+int32 FSGModifierLedger::GetTypedTotal(int32 Slot, ESGBonusType BonusType) const
+{
+    const FBucket* Bucket = Buckets.Find(MakeBucketKey(Slot, BonusType));
+    return Bucket ? Bucket->AppliedValue : 0;
+}
+
+int32 FSGModifierLedger::GetTypedBonus(int32 Slot, ESGBonusType BonusType) const
+{
+    const FBucket* Bucket = Buckets.Find(MakeBucketKey(Slot, BonusType));
+    return Bucket ? Bucket->AppliedBonus : 0;
+}
+
+FSGModifierLedger::FBonusHeap* FSGModifierLedger::FindBonusHeap(FBucket& Bucket, uint16 BucketKey, FName Source)
+{
+    const ESGBonusType BonusType = static_cast<ESGBonusType>(BucketKey % SGModifiers::NumBonusTypes);
+    if (!SGModifiers::DoesBonusTypeStack(BonusType))
+    {
+        return &Bucket.Bonuses;
+    }
+
+    // Stacking types still keep only the highest bonus from each named source
+    return Source.IsNone() ? nullptr : &Bucket.BonusesBySource.FindOrAdd(Source);
+}
+
+void FSGModifierLedger::RemoveEntry(int32 Index)
+{
+    FEntry& Entry = Entries[Index];
+    const uint16 BucketKey = Entry.BucketKey;
+    const FName Source = Entry.Source;
+    const int32 Value = Entry.Value;
+
+    // RemoveAllFromSource detaches the source's list before removing its entries
+    if (TArray<int32, TInlineAllocator<4>>* SourceEntries = EntriesBySource.Find(Source))
+    {
+        SourceEntries->RemoveSingleSwap(Index, EAllowShrinking::No);
+        if (SourceEntries->Num() == 0)
+        {
+            EntriesBySource.Remove(Source);
+        }
+    }
+
+    FBucket& Bucket = Buckets.FindChecked(BucketKey);
+    --Bucket.NumEntries;
+    if (Value < 0)
+    {
+        Bucket.Penalties -= Value;
+    }
+    else if (FBonusHeap* Heap = FindBonusHeap(Bucket, BucketKey, Source))
+    {
+        const int32 OldMax = GetHeapMax(*Heap);
+        HeapRemove(*Heap, Index);
+        Bucket.AppliedBonus += GetHeapMax(*Heap) - OldMax;
+        if (Heap->Num() == 0 && Heap != &Bucket.Bonuses)
+        {
+            Bucket.BonusesBySource.Remove(Source);
+        }
+    }
+    else
+    {
+        Bucket.AppliedBonus -= Value;
+    }
+
+    Entry.bActive = false;
+    Entry.Source = NAME_None;
+    FreeIndices.Add(Index);
+
+    CommitBucket(BucketKey, Bucket);
+}
+
+void FSGModifierLedger::CommitBucket(uint16 BucketKey, FBucket& Bucket)
+{
+    const int32 Slot = BucketKey / SGModifiers::NumBonusTypes;
+
+    const int32 NewValue = Bucket.AppliedBonus + Bucket.Penalties;
+    if (NewValue != Bucket.AppliedValue)
+    {
+        Totals[Slot] += NewValue - Bucket.AppliedValue;
+        Bucket.AppliedValue = NewValue;
+        ChangedSlots |= SGModifiers::SlotBit(Slot);
+    }
+
+    if (Bucket.NumEntries == 0)
+    {
+        Buckets.Remove(BucketKey);
+    }
+}
+
+void FSGModifierLedger::HeapPush(FBonusHeap& Heap, int32 EntryIndex)
+{
+    Entries[EntryIndex].HeapIndex = Heap.Add(EntryIndex);
+    HeapSiftUp(Heap, Heap.Num() - 1);
+}
+
+void FSGModifierLedger::HeapRemove(FBonusHeap& Heap, int32 EntryIndex)
+{
+    const int32 Position = Entries[EntryIndex].HeapIndex;
+    check(Heap.IsValidIndex(Position) && Heap[Position] == EntryIndex);
+    Entries[EntryIndex].HeapIndex = INDEX_NONE;
+
+    const int32 Last = Heap.Pop(EAllowShrinking::No);
+    if (Position < Heap.Num())
+    {
+        Heap[Position] = Last;
+        Entries[Last].HeapIndex = Position;
+        HeapSiftUp(Heap, Position);
+        HeapSiftDown(Heap, Entries[Last].HeapIndex);
+    }
+}
+
+void FSGModifierLedger::HeapSiftUp(FBonusHeap& Heap, int32 Position)
+{
+    while (Position > 0)
+    {
+        const int32 Parent = (Position - 1) / 2;
+        if (Entries[Heap[Parent]].Value >= Entries[Heap[Position]].Value)
+        {
+            break;
+        }
+        Swap(Heap[Parent], Heap[Position]);
+        Entries[Heap[Parent]].HeapIndex = Parent;
+        Entries[Heap[Position]].HeapIndex = Position;
+        Position = Parent;
+    }
+}
+
+void FSGModifierLedger::HeapSiftDown(FBonusHeap& Heap, int32 Position)
+{
+    for (;;)
+    {
+        const int32 Left = Position * 2 + 1;
+        const int32 Right = Left + 1;
+        int32 Largest = Position;
+        if (Left < Heap.Num() && Entries[Heap[Left]].Value > Entries[Heap[Largest]].Value)
+        {
+            Largest = Left;
+        }
+        if (Right < Heap.Num() && Entries[Heap[Right]].Value > Entries[Heap[Largest]].Value)
+        {
+            Largest = Right;
+        }
+        if (Largest == Position)
+        {
+            break;
+        }
+        Swap(Heap[Largest], Heap[Position]);
+        Entries[Heap[Largest]].HeapIndex = Largest;
+        Entries[Heap[Position]].HeapIndex = Position;
+        Position = Largest;
+    }
+}
@@ -0,0 +1,278 @@
+// Copyright 2025 Surviving Gloomspire Team. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SGSkillType.h"
+#include "SGModifierLedger.generated.h"
+
+/**
+ * Pathfinder bonus types. Bonuses of the same type do not stack (only the highest applies)
+ * unless the type is listed in SGModifiers::DoesBonusTypeStack.
+ */
+UENUM(BlueprintType)
+enum class ESGBonusType : uint8
+{
+    Untyped         UMETA(DisplayName = "Untyped"),
+    Alchemical      UMETA(DisplayName = "Alchemical"),
+    Armor           UMETA(DisplayName = "Armor"),
+    Circumstance    UMETA(DisplayName = "Circumstance"),
+    Competence      UMETA(DisplayName = "Competence"),
+    Deflection      UMETA(DisplayName = "Deflection"),
+    Dodge           UMETA(DisplayName = "Dodge"),
+    Enhancement     UMETA(DisplayName = "Enhancement"),
+    Insight         UMETA(DisplayName = "Insight"),
+    Luck            UMETA(DisplayName = "Luck"),
+    Morale          UMETA(DisplayName = "Morale"),
+    NaturalArmor    UMETA(DisplayName = "Natural Armor"),
+    Profane         UMETA(DisplayName = "Profane"),
+    Racial          UMETA(DisplayName = "Racial"),
+    Resistance      UMETA(DisplayName = "Resistance"),
+    Sacred          UMETA(DisplayName = "Sacred"),
+    Shield          UMETA(DisplayName = "Shield"),
+    Size            UMETA(DisplayName = "Size"),
+    Trait           UMETA(DisplayName = "Trait"),
+
+    MAX             UMETA(Hidden)
+};
+
+/**
+ * Stats a modifier can target. Skill modifiers also name the skill, giving one ledger slot per skill.
+ */
+UENUM(BlueprintType)
+enum class ESGModifierTarget : uint8
+{
+    ArmorClass      UMETA(DisplayName = "Armor Class"),
+    Fortitude       UMETA(DisplayName = "Fortitude"),
+    Reflex          UMETA(DisplayName = "Reflex"),
+    Will            UMETA(DisplayName = "Will"),
+    AttackRoll      UMETA(DisplayName = "Attack Roll"),
+    DamageRoll      UMETA(DisplayName = "Damage Roll"),
+    Initiative      UMETA(DisplayName = "Initiative"),
+    MaxHitPoints    UMETA(DisplayName = "Max Hit Points"),
+    Skill           UMETA(DisplayName = "Skill"),
+
+    MAX             UMETA(Hidden)
+};
+
+namespace SGModifiers
+{
+    constexpr int32 NumBonusTypes = static_cast<int32>(ESGBonusType::MAX);
+
+    /** Ledger slot of the first skill; skills occupy one slot each from here */
+    constexpr int32 FirstSkillSlot = static_cast<int32>(ESGModifierTarget::Skill);
+
+    /** Number of aggregated totals the ledger keeps */
+    constexpr int32 NumSlots = FirstSkillSlot + SGSkillCount;
+
+    /** Dodge, circumstance and untyped bonuses stack with each other; all other types keep only the highest */
+    constexpr bool DoesBonusTypeStack(ESGBonusType BonusType)
+    {
+        return BonusType == ESGBonusType::Untyped
+            || BonusType == ESGBonusType::Dodge
+            || BonusType == ESGBonusType::Circumstance;
+    }
+
+    /** Gets the ledger slot for a skill */
+    constexpr int32 SkillSlot(ESGSkillType SkillType)
+    {
+        return FirstSkillSlot + static_cast<int32>(SkillType);
+    }
+
+    /** Gets the ledger slot for a target; SkillType is only used when Target is Skill */
+    constexpr int32 GetSlot(ESGModifierTarget Target, ESGSkillType SkillType = ESGSkillType::Acrobatics)
+    {
+        return Target == ESGModifierTarget::Skill ? SkillSlot(SkillType) : static_cast<int32>(Target);
+    }
+
+    constexpr uint64 SlotBit(int32 Slot)
+    {
+        return uint64(1) << Slot;
+    }
+
+    static_assert(NumSlots <= 64, "Changed slot mask must fit in a uint64");
+    static_assert(NumSlots * NumBonusTypes <= MAX_uint16, "Bucket keys must fit in a uint16");
+}
+
+/**
+ * Identifies a modifier in a ledger so its owner can remove it later
+ */
+USTRUCT(BlueprintType)
+struct FSGModifierHandle
+{
+    GENERATED_BODY()
+
+    FSGModifierHandle()
+        : Index(INDEX_NONE)
+        , Serial(0)
+    {}
+
+    FSGModifierHandle(int32 InIndex, int32 InSerial)
+        : Index(InIndex)
+        , Serial(InSerial)
+    {}
+
+    bool IsValid() const { return Index != INDEX_NONE; }
+
+    void Invalidate() { *this = FSGModifierHandle(); }
+
+    bool operator==(const FSGModifierHandle& Other) const { return Index == Other.Index && Serial == Other.Serial; }
+    bool operator!=(const FSGModifierHandle& Other) const { return !(*this == Other); }
+
+private:
+    friend struct FSGModifierLedger;
+
+    /** Entry slot in the ledger */
+    UPROPERTY()
+    int32 Index;
+
+    /** Guards against removing a newer modifier that reused the slot */
+    UPROPERTY()
+    int32 Serial;
+};
+
+/**
+ * Per-character ledger of bonuses and penalties following the Pathfinder stacking rules.
+ *
+ * Modifiers are grouped into buckets by (slot, bonus type). Each bucket keeps its bonuses in max-heaps
+ * and caches its applied value, and each slot caches the sum of its buckets, so adding or removing a
+ * modifier is O(log n) in the size of its bucket and reading any total is O(1).
+ *
+ * Within a bucket:
+ * - Non-stacking types apply only their highest bonus
+ * - Stacking types sum their bonuses, but two bonuses from the same source still do not stack
+ * - Penalties (negative values) always stack
+ *
+ * The ledger is runtime state; sources re-apply their modifiers when loaded.
+ */
+struct SURVIVINGGLOOMSPIRE_API FSGModifierLedger
+{
+public:
+    /**
+     * Adds a modifier
+     * @param Source Identifies what granted the modifier (feat, spell, item, ...)
+     * @param BonusType Pathfinder bonus type used for stacking
+     * @param Slot Ledger slot, see SGModifiers::GetSlot
+     * @param Value Bonus (positive) or penalty (negative)
+     * @return Handle used to remove the modifier
+     */
+    FSGModifierHandle Add(FName Source, ESGBonusType BonusType, int32 Slot, int32 Value);
+
+    /**
+     * Removes a modifier
+     * @return True if the handle referred to an active modifier
+     */
+    bool Remove(const FSGModifierHandle& Handle);
+
+    /**
+     * Removes every modifier granted by a source
+     * @return Number of modifiers removed
+     */
+    int32 RemoveAllFromSource(FName Source);
+
+    /** Removes every modifier */
+    void Reset();
+
+    /** Gets the stacked total of every modifier on a slot */
+    FORCEINLINE int32 GetTotal(int32 Slot) const
+    {
+        checkSlow(Slot >= 0 && Slot < SGModifiers::NumSlots);
+        return Totals[Slot];
+    }
+
+    /** Gets the applied value of a single bonus type on a slot (e.g. only Armor bonuses to AC), penalties included */
+    int32 GetTypedTotal(int32 Slot, ESGBonusType BonusType) const;
+
+    /** Gets the applied bonus of a single bonus type on a slot, ignoring its penalties */
+    int32 GetTypedBonus(int32 Slot, ESGBonusType BonusType) const;
+
+    /** Gets the number of active modifiers */
+    int32 Num() const { return Entries.Num() - FreeIndices.Num(); }
+
+    /**
+     * Gets the slots whose totals changed since the last call and clears them
+     * @return Bit per changed slot, see SGModifiers::SlotBit
+     */
+    uint64 ConsumeChangedSlots()
+    {
+        const uint64 Result = ChangedSlots;
+        ChangedSlots = 0;
+        return Result;
+    }
+
+private:
+    /** Entry indices arranged as a binary max-heap on value; each entry records its position in FEntry::HeapIndex */
+    using FBonusHeap = TArray<int32, TInlineAllocator<4>>;
+
+    struct FEntry
+    {
+        FName Source;
+        int32 Value = 0;
+        int32 Serial = 0;
+
+        /** Position in the bucket heap holding this entry, or INDEX_NONE for penalties and unnamed stacking bonuses */
+        int32 HeapIndex = INDEX_NONE;
+
+        uint16 BucketKey = 0;
+        bool bActive = false;
+    };
+
+    struct FBucket
+    {
+        /** Bonuses of a non-stacking type; only the top of the heap applies */
+        FBonusHeap Bonuses;
+
+        /** Bonuses of a stacking type keyed by source; the top of each source's heap applies */
+        TMap<FName, FBonusHeap> BonusesBySource;
+
+        /** Sum of every penalty in this bucket */
+        int32 Penalties = 0;
+
+        /** Number of active entries in this bucket */
+        int32 NumEntries = 0;
+
+        /** Value this bucket contributes to its slot */
+        int32 AppliedValue = 0;
+
+        /** Bonus part of AppliedValue */
+        int32 AppliedBonus = 0;
+    };
+
+    static uint16 MakeBucketKey(int32 Slot, ESGBonusType BonusType)
+    {
+        return static_cast<uint16>(Slot * SGModifiers::NumBonusTypes + static_cast<int32>(BonusType));
+    }
+
+    /**
+     * Finds the heap a bonus belongs to within its bucket
+     * @return The heap, or null for unnamed bonuses of a stacking type, which always apply in full
+     */
+    static FBonusHeap* FindBonusHeap(FBucket& Bucket, uint16 BucketKey, FName Source);
+
+    /** Gets the value at the top of a heap, or 0 if it is empty */
+    int32 GetHeapMax(const FBonusHeap& Heap) const
+    {
+        return Heap.Num() > 0 ? Entries[Heap[0]].Value : 0;
+    }
+
+    void HeapPush(FBonusHeap& Heap, int32 EntryIndex);
+    void HeapRemove(FBonusHeap& Heap, int32 EntryIndex);
+    void HeapSiftUp(FBonusHeap& Heap, int32 Position);
+    void HeapSiftDown(FBonusHeap& Heap, int32 Position);
+
+    /** Folds a bucket's new applied value into its slot total and drops the bucket once it is empty */
+    void CommitBucket(uint16 BucketKey, FBucket& Bucket);
+
+    /** Removes an active entry without validating a handle */
+    void RemoveEntry(int32 Index);
+
+    TArray<FEntry> Entries;
+    TArray<int32> FreeIndices;
+    TMap<uint16, FBucket> Buckets;
+
+    /** Active entry indices keyed by source, so a source's modifiers can be removed without scanning the ledger */
+    TMap<FName, TArray<int32, TInlineAllocator<4>>> EntriesBySource;
+    int32 Totals[SGModifiers::NumSlots] = {};
+    uint64 ChangedSlots = 0;
+    int32 NextSerial = 1;
+};
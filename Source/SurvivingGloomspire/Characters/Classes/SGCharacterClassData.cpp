@@ -1,6 +1,16 @@
 // Copyright 2025 Surviving Gloomspire Team. All Rights Reserved.
 
 #include "SGCharacterClassData.h"
+#include "SGLog.h"
+
+#if WITH_EDITOR
+#include "Misc/DataValidation.h"
+#include "UObject/ObjectSaveContext.h"
+#endif
+
+#define LOCTEXT_NAMESPACE "SGCharacterClassData"
+
+const FPrimaryAssetType USGCharacterClassData::PrimaryAssetType(TEXT("CharacterClass"));
 
 const FSGClassLevelData& USGCharacterClassData::GetLevelData(int32 Level) const
 {
@@ -14,5 +24,90 @@ const FSGClassLevelData& USGCharacterClassData::GetLevelData(int32 Level) const
 
 FPrimaryAssetId USGCharacterClassData::GetPrimaryAssetId() const
 {
-    return FPrimaryAssetId("CharacterClass", GetFName());
+    return FPrimaryAssetId(PrimaryAssetType, GetFName());
+}
+
+const FSGClassFeaturePayload& USGCharacterClassData::GetFeaturePayload(int32 FeatureIndex) const
+{
+    static const FSGClassFeaturePayload EmptyPayload;
+    return FeaturePayloads.IsValidIndex(FeatureIndex) ? FeaturePayloads[FeatureIndex] : EmptyPayload;
+}
+
+int32 USGCharacterClassData::GetNumFeatures() const
+{
+    int32 NumFeatures = 0;
+    for (const FSGClassLevelData& Level : LevelData)
+    {
+        NumFeatures += Level.FeaturesGranted.Num();
+    }
+    return NumFeatures;
+}
+
+#if WITH_EDITOR
+void USGCharacterClassData::PostLoad()
+{
+    Super::PostLoad();
+    
+    // Assets saved before payloads existed, or edited outside the editor, compile now
+    if (FeaturePayloads.Num() != GetNumFeatures())
+    {
+        CompileFeaturePayloads();
+    }
+}
+
+void USGCharacterClassData::PreSave(FObjectPreSaveContext SaveContext)
+{
+    Super::PreSave(SaveContext);
+    
+    TArray<FText> Errors;
+    CompileFeaturePayloads(&Errors);
+    for (const FText& Error : Errors)
+    {
+        UE_LOG(LogSGClasses, Error, TEXT("%s: %s"), *GetPathName(), *Error.ToString());
+    }
+}
+
+EDataValidationResult USGCharacterClassData::IsDataValid(FDataValidationContext& Context) const
+{
+    EDataValidationResult Result = Super::IsDataValid(Context);
+    
+    if (ClassType == ESGClassType::None)
+    {
+        Context.AddError(LOCTEXT("MissingClassType", "Class type is not set"));
+        Result = EDataValidationResult::Invalid;
+    }
+    
+    TArray<FText> Errors;
+    FSGClassFeaturePayload Payload;
+    for (const FSGClassLevelData& Level : LevelData)
+    {
+        for (const FSGClassFeature& Feature : Level.FeaturesGranted)
+        {
+            SGClassFeatures::Compile(Feature, Payload, &Errors);
+        }
+    }
+    for (const FText& Error : Errors)
+    {
+        Context.AddError(Error);
+        Result = EDataValidationResult::Invalid;
+    }
+    
+    return Result;
+}
+
+bool USGCharacterClassData::CompileFeaturePayloads(TArray<FText>* OutErrors)
+{
+    FeaturePayloads.Reset(GetNumFeatures());
+    bool bAllCompiled = true;
+    for (const FSGClassLevelData& Level : LevelData)
+    {
+        for (const FSGClassFeature& Feature : Level.FeaturesGranted)
+        {
+            bAllCompiled &= SGClassFeatures::Compile(Feature, FeaturePayloads.AddDefaulted_GetRef(), OutErrors);
+        }
+    }
+    return bAllCompiled;
 }
+#endif
+
+#undef LOCTEXT_NAMESPACE
@@ -44,6 +44,10 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Class Data")
     TArray<FSGClassLevelData> LevelData;
     
+    /** Compiled FeatureData of every feature in LevelData, in level then listed order; rebuilt when the asset is saved */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Class Data")
+    TArray<FSGClassFeaturePayload> FeaturePayloads;
+    
     /**
      * Get the level data for a specific level (1-based index)
      * @param Level Level to get data for (1-20)
@@ -52,7 +56,35 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Class Data")
     const FSGClassLevelData& GetLevelData(int32 Level) const;
     
+    /**
+     * Get a feature's compiled payload
+     * @param FeatureIndex Index of the feature counting through LevelData in order
+     * @return The payload, or an empty payload if the index is out of range
+     */
+    const FSGClassFeaturePayload& GetFeaturePayload(int32 FeatureIndex) const;
+    
+    /** Get the number of features listed across all of LevelData */
+    int32 GetNumFeatures() const;
+    
     //~ Begin UPrimaryDataAsset Interface
     virtual FPrimaryAssetId GetPrimaryAssetId() const override;
     //~ End UPrimaryDataAsset Interface
+    
+#if WITH_EDITOR
+    //~ Begin UObject Interface
+    virtual void PostLoad() override;
+    virtual void PreSave(FObjectPreSaveContext SaveContext) override;
+    virtual EDataValidationResult IsDataValid(FDataValidationContext& Context) const override;
+    //~ End UObject Interface
+    
+    /**
+     * Compiles every feature's FeatureData into FeaturePayloads
+     * @param OutErrors If set, receives one message per entry that could not be compiled
+     * @return True if every entry compiled
+     */
+    bool CompileFeaturePayloads(TArray<FText>* OutErrors = nullptr);
+#endif
+    
+    /** Primary asset type every class asset is registered under */
+    static const FPrimaryAssetType PrimaryAssetType;
 };
@@ -0,0 +1,141 @@
+// Copyright 2025 Surviving Gloomspire Team. All Rights Reserved.
+
+#include "SGClassFeature.h"
+#include "SGCompileDiagnostics.h"
+#include "SGEnumNames.h"
+
+#if WITH_EDITOR
+
+#define LOCTEXT_NAMESPACE "SGClassFeatures"
+
+namespace SGClassFeatures
+{
+    namespace Private
+    {
+        const FName DiceKey(TEXT("Dice"));
+        const FName UsesPerDayKey(TEXT("UsesPerDay"));
+        const FName BonusKey(TEXT("Bonus"));
+        const FName BonusTypeKey(TEXT("BonusType"));
+        const FName TargetKey(TEXT("Target"));
+        const FName SkillKey(TEXT("Skill"));
+
+        /** Parses a whole-number value within [Min, Max] */
+        bool ParseInt(const FString& Value, int32 Min, int32 Max, int32& OutValue)
+        {
+            const FString Trimmed = Value.TrimStartAndEnd();
+            if (Trimmed.IsEmpty() || !Trimmed.IsNumeric() || Trimmed.Contains(TEXT(".")))
+            {
+                return false;
+            }
+            OutValue = FCString::Atoi(*Trimmed);
+            return OutValue >= Min && OutValue <= Max;
+        }
+
+        /** Parses dice notation such as "2d6" or "d8" */
+        bool ParseDice(const FString& Value, uint8& OutCount, uint8& OutSides)
+        {
+            FString CountString;
+            FString SidesString;
+            if (!Value.TrimStartAndEnd().Split(TEXT("d"), &CountString, &SidesString, ESearchCase::IgnoreCase))
+            {
+                return false;
+            }
+
+            int32 Count = 1;
+            int32 Sides = 0;
+            if ((!CountString.IsEmpty() && !ParseInt(CountString, 1, MAX_uint8, Count)) || !ParseInt(SidesString, 2, MAX_uint8, Sides))
+            {
+                return false;
+            }
+
+            OutCount = static_cast<uint8>(Count);
+            OutSides = static_cast<uint8>(Sides);
+            return true;
+        }
+    }
+
+    bool Compile(const FSGClassFeature& Feature, FSGClassFeaturePayload& OutPayload, TArray<FText>* OutErrors)
+    {
+        OutPayload = FSGClassFeaturePayload();
+        FSGCompileDiagnostics Diagnostics(OutErrors, FText::Format(LOCTEXT("FeatureSubject", "Feature {0}"), FText::FromName(Feature.FeatureName)));
+
+        bool bHasSkill = false;
+        for (const TPair<FName, FString>& Entry : Feature.FeatureData)
+        {
+            const FText ValueText = FText::FromString(Entry.Value);
+            int32 Parsed = 0;
+
+            if (Entry.Key == Private::DiceKey)
+            {
+                if (!Private::ParseDice(Entry.Value, OutPayload.DiceCount, OutPayload.DiceSides))
+                {
+                    Diagnostics.AddError(FText::Format(LOCTEXT("BadDice", "Dice '{0}' is not dice notation such as 2d6"), ValueText));
+                }
+            }
+            else if (Entry.Key == Private::UsesPerDayKey)
+            {
+                if (Private::ParseInt(Entry.Value, 0, MAX_uint8, Parsed))
+                {
+                    OutPayload.UsesPerDay = static_cast<uint8>(Parsed);
+                }
+                else
+                {
+                    Diagnostics.AddError(FText::Format(LOCTEXT("BadUses", "UsesPerDay '{0}' is not a whole number from 0 to 255"), ValueText));
+                }
+            }
+            else if (Entry.Key == Private::BonusKey)
+            {
+                if (Private::ParseInt(Entry.Value, MIN_int16, MAX_int16, Parsed))
+                {
+                    OutPayload.Bonus = static_cast<int16>(Parsed);
+                }
+                else
+                {
+                    Diagnostics.AddError(FText::Format(LOCTEXT("BadBonus", "Bonus '{0}' is not a whole number"), ValueText));
+                }
+            }
+            else if (Entry.Key == Private::BonusTypeKey)
+            {
+                if (!SGEnumNames::Resolve(Entry.Value, static_cast<int32>(ESGBonusType::MAX), OutPayload.BonusType))
+                {
+                    Diagnostics.AddError(FText::Format(LOCTEXT("BadBonusType", "BonusType '{0}' is not a bonus type"), ValueText));
+                }
+            }
+            else if (Entry.Key == Private::TargetKey)
+            {
+                if (SGEnumNames::Resolve(Entry.Value, static_cast<int32>(ESGModifierTarget::MAX), OutPayload.Target))
+                {
+                    OutPayload.bHasModifier = true;
+                }
+                else
+                {
+                    Diagnostics.AddError(FText::Format(LOCTEXT("BadTarget", "Target '{0}' is not a modifier target"), ValueText));
+                }
+            }
+            else if (Entry.Key == Private::SkillKey)
+            {
+                bHasSkill = SGEnumNames::Resolve(Entry.Value, SGSkillCount, OutPayload.SkillType);
+                if (!bHasSkill)
+                {
+                    Diagnostics.AddError(FText::Format(LOCTEXT("BadSkill", "Skill '{0}' is not a skill"), ValueText));
+                }
+            }
+            else
+            {
+                Diagnostics.AddError(FText::Format(LOCTEXT("UnknownKey", "Unknown data key '{0}'"), FText::FromName(Entry.Key)));
+            }
+        }
+
+        if (OutPayload.bHasModifier && OutPayload.Target == ESGModifierTarget::Skill && !bHasSkill)
+        {
+            Diagnostics.AddError(LOCTEXT("MissingSkill", "Skill modifiers must name a Skill"));
+            OutPayload.bHasModifier = false;
+        }
+
+        return Diagnostics.AllCompiled();
+    }
+}
+
+#undef LOCTEXT_NAMESPACE
+
+#endif // WITH_EDITOR
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "SGModifierLedger.h"
 #include "SGClassFeature.generated.h"
 
 /**
@@ -15,14 +16,72 @@ struct FSGClassFeature
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Class Feature")
     FName FeatureName;
-    
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Class Feature")
     FText Description;
-    
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Class Feature")
     int32 LevelUnlocked = 1;
-    
-    // Optional data specific to this feature
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Class Feature")
+
+#if WITH_EDITORONLY_DATA
+    /**
+     * Optional data specific to this feature, compiled into an FSGClassFeaturePayload when the class is saved.
+     * Keys: Dice ("2d6"), UsesPerDay, Bonus, BonusType (an ESGBonusType), Target (an ESGModifierTarget)
+     * and Skill (an ESGSkillType, required when Target is Skill).
+     */
+    UPROPERTY(EditAnywhere, Category = "Class Feature")
     TMap<FName, FString> FeatureData;
+#endif
 };
+
+/**
+ * A class feature's FeatureData compiled into typed fields, so nothing parses strings at runtime
+ */
+USTRUCT(BlueprintType)
+struct FSGClassFeaturePayload
+{
+    GENERATED_BODY()
+
+    /** Number of dice the feature rolls, e.g. 2 for 2d6 */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Class Feature")
+    uint8 DiceCount = 0;
+
+    /** Sides on each die, e.g. 6 for 2d6 */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Class Feature")
+    uint8 DiceSides = 0;
+
+    /** Uses per day; 0 for features that are always on */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Class Feature")
+    uint8 UsesPerDay = 0;
+
+    /** Whether the feature adds Bonus to Target while active */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Class Feature")
+    bool bHasModifier = false;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Class Feature")
+    ESGModifierTarget Target = ESGModifierTarget::ArmorClass;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Class Feature")
+    ESGBonusType BonusType = ESGBonusType::Untyped;
+
+    /** The skill modified when Target is Skill */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Class Feature")
+    ESGSkillType SkillType = ESGSkillType::Acrobatics;
+
+    UPROPERTY(VisibleAnywhere, Category = "Class Feature")
+    int16 Bonus = 0;
+};
+
+#if WITH_EDITOR
+namespace SGClassFeatures
+{
+    /**
+     * Compiles a feature's FeatureData into a typed payload, resolving and parsing every value once
+     * @param Feature The authored feature
+     * @param OutPayload Receives the payload; entries that fail to compile are left at their defaults
+     * @param OutErrors If set, receives one message per entry that could not be compiled
+     * @return True if every entry compiled
+     */
+    SURVIVINGGLOOMSPIRE_API bool Compile(const FSGClassFeature& Feature, FSGClassFeaturePayload& OutPayload, TArray<FText>* OutErrors = nullptr);
+}
+#endif
@@ -0,0 +1,242 @@
+// Copyright 2025 Surviving Gloomspire Team. All Rights Reserved.
+
+#include "SGClassRegistry.h"
+#include "SGCharacterClassData.h"
+#include "SGRulesTables.h"
+#include "SGLog.h"
+#include "Algo/StableSort.h"
+
+void USGClassRegistry::Initialize(FSubsystemCollectionBase& Collection)
+{
+    ClassesByType.Init(nullptr, SGClassTypeCount);
+    for (int32 ClassIndex = 0; ClassIndex < SGClassTypeCount; ++ClassIndex)
+    {
+        BuildProgression(static_cast<ESGClassType>(ClassIndex), nullptr);
+    }
+
+    // Starts the load, which may register every class before returning
+    Super::Initialize(Collection);
+}
+
+void USGClassRegistry::Deinitialize()
+{
+    ClassesByType.Reset();
+    for (int32 ClassIndex = 0; ClassIndex < SGClassTypeCount; ++ClassIndex)
+    {
+        ProgressionByClass[ClassIndex].Reset();
+        FeaturesByClass[ClassIndex].Reset();
+        PayloadsByClass[ClassIndex].Reset();
+        NumFeaturesByLevel[ClassIndex].Reset();
+    }
+
+    Super::Deinitialize();
+}
+
+USGClassRegistry* USGClassRegistry::Get(const UObject* WorldContextObject)
+{
+    return GetRegistry<USGClassRegistry>(WorldContextObject);
+}
+
+const FSGClassProgressionTotals& USGClassRegistry::GetClassProgression(ESGClassType ClassType, int32 ClassLevel) const
+{
+    static const FSGClassProgressionTotals NoProgression;
+
+    const int32 ClassIndex = static_cast<int32>(ClassType);
+    if (ClassIndex >= SGClassTypeCount || ProgressionByClass[ClassIndex].Num() == 0)
+    {
+        return NoProgression;
+    }
+
+    const TArray<FSGClassProgressionTotals>& Table = ProgressionByClass[ClassIndex];
+    return Table[FMath::Clamp(ClassLevel, 0, Table.Num() - 1)];
+}
+
+FSGClassProgressionTotals USGClassRegistry::GetProgressionTotals(TConstArrayView<FSGCharacterClassLevel> ClassLevels) const
+{
+    FSGClassProgressionTotals Totals;
+    for (const FSGCharacterClassLevel& ClassLevel : ClassLevels)
+    {
+        Totals += GetClassProgression(ClassLevel.ClassType, ClassLevel.Level);
+    }
+    return Totals;
+}
+
+FSGClassProgressionTotals USGClassRegistry::GetDefaultProgressionTotals(TConstArrayView<FSGCharacterClassLevel> ClassLevels)
+{
+    FSGClassProgressionTotals Totals;
+    for (const FSGCharacterClassLevel& ClassLevel : ClassLevels)
+    {
+        if (static_cast<int32>(ClassLevel.ClassType) >= SGClassTypeCount || ClassLevel.Level <= 0)
+        {
+            continue;
+        }
+
+        const SGRules::FClassProgression& Progression = SGRules::GetClassProgression(ClassLevel.ClassType);
+        Totals.BaseAttackBonus += SGRules::GetClassBaseAttackBonus(ClassLevel.ClassType, ClassLevel.Level);
+        Totals.FortitudeSave += SGRules::GetClassBaseSave(ClassLevel.ClassType, ESGSavingThrowType::Fortitude, ClassLevel.Level);
+        Totals.ReflexSave += SGRules::GetClassBaseSave(ClassLevel.ClassType, ESGSavingThrowType::Reflex, ClassLevel.Level);
+        Totals.WillSave += SGRules::GetClassBaseSave(ClassLevel.ClassType, ESGSavingThrowType::Will, ClassLevel.Level);
+        Totals.SkillRanks += Progression.SkillRanksPerLevel * ClassLevel.Level;
+        Totals.HitDiceTotal += Progression.HitDie * ClassLevel.Level;
+    }
+    return Totals;
+}
+
+int32 USGClassRegistry::GetNumFeaturesUnlocked(ESGClassType ClassType, int32 ClassLevel) const
+{
+    const int32 ClassIndex = static_cast<int32>(ClassType);
+    if (ClassIndex >= SGClassTypeCount || NumFeaturesByLevel[ClassIndex].Num() == 0 || ClassLevel <= 0)
+    {
+        return 0;
+    }
+
+    const TArray<uint16>& Counts = NumFeaturesByLevel[ClassIndex];
+    return Counts[FMath::Min(ClassLevel, Counts.Num() - 1)];
+}
+
+void USGClassRegistry::BuildFeatureList(ESGClassType ClassType, const USGCharacterClassData& ClassData)
+{
+    const int32 ClassIndex = static_cast<int32>(ClassType);
+    TArray<const FSGClassFeature*>& Features = FeaturesByClass[ClassIndex];
+    TArray<const FSGClassFeaturePayload*>& Payloads = PayloadsByClass[ClassIndex];
+    Features.Reset();
+    Payloads.Reset();
+
+    if (ClassData.FeaturePayloads.Num() != ClassData.GetNumFeatures())
+    {
+        UE_LOG(LogSGClasses, Warning, TEXT("SGClassRegistry: %s has %d feature payloads for %d features, resave the asset"),
+            *ClassData.GetName(), ClassData.FeaturePayloads.Num(), ClassData.GetNumFeatures());
+    }
+
+    int32 MaxUnlockLevel = 0;
+    for (int32 Level = 1; Level <= ClassData.LevelData.Num(); ++Level)
+    {
+        for (const FSGClassFeature& Feature : ClassData.LevelData[Level - 1].FeaturesGranted)
+        {
+            if (Feature.LevelUnlocked != Level)
+            {
+                UE_LOG(LogSGClasses, Warning, TEXT("SGClassRegistry: %s lists %s under level %d but unlocks it at level %d"),
+                    *ClassData.GetName(), *Feature.FeatureName.ToString(), Level, Feature.LevelUnlocked);
+            }
+            Payloads.Add(&ClassData.GetFeaturePayload(Features.Num()));
+            Features.Add(&Feature);
+            MaxUnlockLevel = FMath::Max3(MaxUnlockLevel, Feature.LevelUnlocked, 1);
+        }
+    }
+
+    // Stable, so features unlocked at the same level keep their authored order
+    TArray<int32> Order;
+    Order.Reserve(Features.Num());
+    for (int32 Index = 0; Index < Features.Num(); ++Index)
+    {
+        Order.Add(Index);
+    }
+    Algo::StableSortBy(Order, [&Features](int32 Index) { return FMath::Max(Features[Index]->LevelUnlocked, 1); });
+
+    const TArray<const FSGClassFeature*> ListedFeatures = Features;
+    const TArray<const FSGClassFeaturePayload*> ListedPayloads = Payloads;
+    for (int32 Index = 0; Index < Order.Num(); ++Index)
+    {
+        Features[Index] = ListedFeatures[Order[Index]];
+        Payloads[Index] = ListedPayloads[Order[Index]];
+    }
+
+    TArray<uint16>& Counts = NumFeaturesByLevel[ClassIndex];
+    Counts.Reset(MaxUnlockLevel + 1);
+    Counts.AddZeroed(MaxUnlockLevel + 1);
+    int32 NumUnlocked = 0;
+    for (int32 Level = 1; Level <= MaxUnlockLevel; ++Level)
+    {
+        while (NumUnlocked < Features.Num() && FMath::Max(Features[NumUnlocked]->LevelUnlocked, 1) <= Level)
+        {
+            ++NumUnlocked;
+        }
+        Counts[Level] = static_cast<uint16>(NumUnlocked);
+    }
+}
+
+void USGClassRegistry::BuildProgression(ESGClassType ClassType, const USGCharacterClassData* ClassData)
+{
+    const SGRules::FClassProgression& Defaults = SGRules::GetClassProgression(ClassType);
+    const int32 NumAuthoredLevels = ClassData ? ClassData->LevelData.Num() : 0;
+    const int32 NumLevels = FMath::Max(SGRules::MaxTableLevel, NumAuthoredLevels);
+
+    // Per-level values fall back from the level entry to the class asset to the core progression
+    const int32 ClassSkillRanks = ClassData && ClassData->SkillRanksPerLevel > 0 ? ClassData->SkillRanksPerLevel : Defaults.SkillRanksPerLevel;
+    const int32 ClassHitDie = ClassData && ClassData->HitDie > 0 ? ClassData->HitDie : Defaults.HitDie;
+
+    TArray<FSGClassProgressionTotals>& Table = ProgressionByClass[static_cast<int32>(ClassType)];
+    Table.Reset(NumLevels + 1);
+    Table.AddDefaulted(NumLevels + 1);
+
+    for (int32 Level = 1; Level <= NumLevels; ++Level)
+    {
+        const FSGClassProgressionTotals& Previous = Table[Level - 1];
+        FSGClassProgressionTotals& Totals = Table[Level];
+
+        // Authored BAB and saves are already the class's totals at that level, as in a class table
+        if (Level <= NumAuthoredLevels)
+        {
+            const FSGClassLevelData& LevelData = ClassData->LevelData[Level - 1];
+            Totals.BaseAttackBonus = LevelData.BaseAttackBonus;
+            Totals.FortitudeSave = LevelData.FortitudeSave;
+            Totals.ReflexSave = LevelData.ReflexSave;
+            Totals.WillSave = LevelData.WillSave;
+            Totals.SkillRanks = Previous.SkillRanks + (LevelData.SkillRanks > 0 ? LevelData.SkillRanks : ClassSkillRanks);
+            Totals.HitDiceTotal = Previous.HitDiceTotal + (LevelData.HitDie > 0 ? LevelData.HitDie : ClassHitDie);
+        }
+        else
+        {
+            Totals.BaseAttackBonus = SGRules::GetClassBaseAttackBonus(ClassType, Level);
+            Totals.FortitudeSave = SGRules::GetClassBaseSave(ClassType, ESGSavingThrowType::Fortitude, Level);
+            Totals.ReflexSave = SGRules::GetClassBaseSave(ClassType, ESGSavingThrowType::Reflex, Level);
+            Totals.WillSave = SGRules::GetClassBaseSave(ClassType, ESGSavingThrowType::Will, Level);
+            Totals.SkillRanks = Previous.SkillRanks + ClassSkillRanks;
+            Totals.HitDiceTotal = Previous.HitDiceTotal + ClassHitDie;
+        }
+    }
+}
+
+FPrimaryAssetType USGClassRegistry::GetPrimaryAssetType() const
+{
+    return USGCharacterClassData::PrimaryAssetType;
+}
+
+bool USGClassRegistry::RegisterAsset(const FPrimaryAssetId& AssetId, UObject* Asset)
+{
+    const USGCharacterClassData* ClassData = Cast<USGCharacterClassData>(Asset);
+    if (!ClassData)
+    {
+        UE_LOG(LogSGClasses, Warning, TEXT("SGClassRegistry: Failed to load %s"), *AssetId.ToString());
+        return false;
+    }
+
+    const int32 ClassIndex = static_cast<int32>(ClassData->ClassType);
+    if (ClassData->ClassType == ESGClassType::None || ClassIndex >= SGClassTypeCount)
+    {
+        UE_LOG(LogSGClasses, Warning, TEXT("SGClassRegistry: %s has no class type"), *AssetId.ToString());
+        return false;
+    }
+
+    TObjectPtr<const USGCharacterClassData>& Slot = ClassesByType[ClassIndex];
+    if (Slot)
+    {
+        UE_LOG(LogSGClasses, Warning, TEXT("SGClassRegistry: %s and %s both define %s, keeping the first"),
+            *GetNameSafe(Slot), *AssetId.ToString(), *GetClassTypeAsString(ClassData->ClassType));
+        return false;
+    }
+
+    Slot = ClassData;
+
+    BuildProgression(ClassData->ClassType, ClassData);
+    BuildFeatureList(ClassData->ClassType, *ClassData);
+    return true;
+}
+
+void USGClassRegistry::HandleAssetsLoaded()
+{
+    UE_LOG(LogSGClasses, Log, TEXT("SGClassRegistry: Loaded %d of %d classes in %.1f ms"),
+        GetNumLoadedAssets(), SGClassTypeCount - 1, GetLoadTimeSeconds() * 1000.0f);
+
+    OnClassesLoaded.Broadcast(GetNumLoadedAssets());
+}
@@ -0,0 +1,180 @@
+// Copyright 2025 Surviving Gloomspire Team. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SGDataAssetRegistry.h"
+#include "SGCharacterClass.h"
+#include "SGSavingThrows.h"
+#include "SGClassRegistry.generated.h"
+
+class USGCharacterClassData;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnSGClassesLoaded, int32, NumClasses);
+
+/**
+ * Progression a character has accumulated from its class levels
+ */
+USTRUCT(BlueprintType)
+struct SURVIVINGGLOOMSPIRE_API FSGClassProgressionTotals
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Class Progression")
+    int32 BaseAttackBonus = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Class Progression")
+    int32 FortitudeSave = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Class Progression")
+    int32 ReflexSave = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Class Progression")
+    int32 WillSave = 0;
+
+    /** Skill ranks granted by class, before the Intelligence modifier */
+    UPROPERTY(BlueprintReadOnly, Category = "Class Progression")
+    int32 SkillRanks = 0;
+
+    /** Sum of the hit die sizes, i.e. hit points from dice if every die rolled its maximum */
+    UPROPERTY(BlueprintReadOnly, Category = "Class Progression")
+    int32 HitDiceTotal = 0;
+
+    int32 GetBaseSave(ESGSavingThrowType SaveType) const
+    {
+        return SaveType == ESGSavingThrowType::Fortitude ? FortitudeSave
+            : (SaveType == ESGSavingThrowType::Reflex ? ReflexSave : WillSave);
+    }
+
+    FSGClassProgressionTotals& operator+=(const FSGClassProgressionTotals& Other)
+    {
+        BaseAttackBonus += Other.BaseAttackBonus;
+        FortitudeSave += Other.FortitudeSave;
+        ReflexSave += Other.ReflexSave;
+        WillSave += Other.WillSave;
+        SkillRanks += Other.SkillRanks;
+        HitDiceTotal += Other.HitDiceTotal;
+        return *this;
+    }
+};
+
+/**
+ * Loads every character class data asset through the Asset Manager when the game instance starts and
+ * turns each class's level data into a table of progression totals indexed by class level.
+ *
+ * Base attack bonus and saves are read on every attack and save, so the totals for any combination of
+ * class levels are one table read per class. Classes without an asset use the core progressions from
+ * SGRules, which are also in place before loading finishes.
+ */
+UCLASS()
+class SURVIVINGGLOOMSPIRE_API USGClassRegistry : public USGDataAssetRegistry
+{
+    GENERATED_BODY()
+
+public:
+    //~ Begin USubsystem Interface
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    //~ End USubsystem Interface
+
+    /** Gets the class registry for an object's game instance, or null outside a game */
+    static USGClassRegistry* Get(const UObject* WorldContextObject);
+
+    /**
+     * Gets the data for a class
+     * @param ClassType The class to look up
+     * @return The class data, or null if no asset defines the class or loading has not finished
+     */
+    const USGCharacterClassData* GetClassData(ESGClassType ClassType) const
+    {
+        const int32 ClassIndex = static_cast<int32>(ClassType);
+        return ClassIndex < ClassesByType.Num() ? ClassesByType[ClassIndex].Get() : nullptr;
+    }
+
+    /**
+     * Gets the progression a class has accumulated at a class level
+     * @param ClassType The class
+     * @param ClassLevel Levels taken in that class, clamped to the class's table
+     */
+    const FSGClassProgressionTotals& GetClassProgression(ESGClassType ClassType, int32 ClassLevel) const;
+
+    /**
+     * Gets the progression totals for a combination of class levels, one table read per class
+     * @param ClassLevels The character's class levels
+     */
+    FSGClassProgressionTotals GetProgressionTotals(TConstArrayView<FSGCharacterClassLevel> ClassLevels) const;
+
+    /**
+     * Gets the progression totals from the core SGRules progressions alone, for use without a game instance
+     * @param ClassLevels The character's class levels
+     */
+    static FSGClassProgressionTotals GetDefaultProgressionTotals(TConstArrayView<FSGCharacterClassLevel> ClassLevels);
+
+    /**
+     * Gets every feature a class grants, ordered by LevelUnlocked.
+     * A feature's index in this list is its bit in a character's active feature set.
+     * @return The features; empty if no asset defines the class
+     */
+    TConstArrayView<const FSGClassFeature*> GetClassFeatures(ESGClassType ClassType) const
+    {
+        const int32 ClassIndex = static_cast<int32>(ClassType);
+        return ClassIndex < SGClassTypeCount ? TConstArrayView<const FSGClassFeature*>(FeaturesByClass[ClassIndex]) : TConstArrayView<const FSGClassFeature*>();
+    }
+
+    /**
+     * Gets the compiled payloads of a class's features, in the same order as GetClassFeatures
+     * @return The payloads; empty if no asset defines the class
+     */
+    TConstArrayView<const FSGClassFeaturePayload*> GetClassFeaturePayloads(ESGClassType ClassType) const
+    {
+        const int32 ClassIndex = static_cast<int32>(ClassType);
+        return ClassIndex < SGClassTypeCount ? TConstArrayView<const FSGClassFeaturePayload*>(PayloadsByClass[ClassIndex]) : TConstArrayView<const FSGClassFeaturePayload*>();
+    }
+
+    /**
+     * Gets how many of a class's features are unlocked at a class level.
+     * Features are ordered by unlock level, so these are the first entries of GetClassFeatures.
+     * @param ClassType The class
+     * @param ClassLevel Levels taken in that class
+     */
+    int32 GetNumFeaturesUnlocked(ESGClassType ClassType, int32 ClassLevel) const;
+
+    /** Broadcast once the initial asset load has finished */
+    UPROPERTY(BlueprintAssignable, Category = "Classes")
+    FOnSGClassesLoaded OnClassesLoaded;
+
+protected:
+    //~ Begin USGDataAssetRegistry Interface
+    virtual FPrimaryAssetType GetPrimaryAssetType() const override;
+    virtual bool RegisterAsset(const FPrimaryAssetId& AssetId, UObject* Asset) override;
+    virtual void HandleAssetsLoaded() override;
+    //~ End USGDataAssetRegistry Interface
+
+private:
+
+    /**
+     * Rebuilds a class's progression table
+     * @param ClassType The class
+     * @param ClassData The class's asset, or null to use the SGRules progression
+     */
+    void BuildProgression(ESGClassType ClassType, const USGCharacterClassData* ClassData);
+
+    /** Collects a class asset's features into FeaturesByClass, ordered by unlock level */
+    void BuildFeatureList(ESGClassType ClassType, const USGCharacterClassData& ClassData);
+
+    /** Class data indexed by ESGClassType */
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<const USGCharacterClassData>> ClassesByType;
+
+    /** Progression totals indexed by [ESGClassType][class level]; entry 0 of each table is all zeroes */
+    TArray<FSGClassProgressionTotals> ProgressionByClass[SGClassTypeCount];
+
+    /** Features indexed by [ESGClassType][feature], pointing into the class assets held by ClassesByType */
+    TArray<const FSGClassFeature*> FeaturesByClass[SGClassTypeCount];
+
+    /** Feature payloads in FeaturesByClass order, pointing into the same class assets */
+    TArray<const FSGClassFeaturePayload*> PayloadsByClass[SGClassTypeCount];
+
+    /** Number of features unlocked indexed by [ESGClassType][class level] */
+    TArray<uint16> NumFeaturesByLevel[SGClassTypeCount];
+};
@@ -25,10 +25,8 @@ enum class ESGClassType : uint8
     Wizard      UMETA(DisplayName = "Wizard")
 };
 
-// Helper function to convert enum to string
-static FString GetClassTypeAsString(ESGClassType ClassType)
-{
-    const UEnum* EnumPtr = FindObject<UEnum>(nullptr, TEXT("/Script/SurvivingGloomspire.ESGClassType"), true);
-    if (!EnumPtr) return FString("Unknown");
-    return EnumPtr->GetNameStringByValue(static_cast<int64>(ClassType));
-}
+/** Number of class types including None, used to size enum-indexed class arrays */
+constexpr int32 SGClassTypeCount = static_cast<int32>(ESGClassType::Wizard) + 1;
+
+// Helper function to convert enum to string, backed by FSGDisplayNames
+SURVIVINGGLOOMSPIRE_API const FString& GetClassTypeAsString(ESGClassType ClassType);
@@ -0,0 +1,65 @@
+// Copyright 2025 Surviving Gloomspire Team. All Rights Reserved.
+
+#include "SGArmorClassBatch.h"
+
+void FSGArmorClassBatch::Reset(int32 ExpectedNum)
+{
+    for (TArray<int32>* Column : { &Base, &ArmorBonus, &ShieldBonus, &NaturalArmor, &DeflectionBonus, &DodgeBonus,
+        &DexterityModifier, &MaxDexBonus, &SizeModifier, &OtherModifiers })
+    {
+        Column->Reset(ExpectedNum);
+    }
+}
+
+int32 FSGArmorClassBatch::Add(const FSGArmorClass& ArmorClass, int32 InDexterityModifier, int32 InSizeModifier, int32 InOtherModifiers)
+{
+    const int32 Index = Base.Add(ArmorClass.Base);
+    ArmorBonus.Add(ArmorClass.ArmorBonus);
+    ShieldBonus.Add(ArmorClass.ShieldBonus);
+    NaturalArmor.Add(ArmorClass.NaturalArmor);
+    DeflectionBonus.Add(ArmorClass.DeflectionBonus);
+    DodgeBonus.Add(ArmorClass.DodgeBonus);
+    DexterityModifier.Add(InDexterityModifier);
+    MaxDexBonus.Add(ArmorClass.GetMaxDexBonus());
+    SizeModifier.Add(InSizeModifier);
+    OtherModifiers.Add(InOtherModifiers);
+    return Index;
+}
+
+namespace SGCombat
+{
+    void EvaluateArmorClassBatch(const FSGArmorClassBatch& Batch, FSGArmorClassBatchResult& OutResult)
+    {
+        const int32 Count = Batch.Num();
+        OutResult.Total.SetNumUninitialized(Count, EAllowShrinking::No);
+        OutResult.Touch.SetNumUninitialized(Count, EAllowShrinking::No);
+        OutResult.FlatFooted.SetNumUninitialized(Count, EAllowShrinking::No);
+
+        const int32* RESTRICT Base = Batch.Base.GetData();
+        const int32* RESTRICT Armor = Batch.ArmorBonus.GetData();
+        const int32* RESTRICT Shield = Batch.ShieldBonus.GetData();
+        const int32* RESTRICT Natural = Batch.NaturalArmor.GetData();
+        const int32* RESTRICT Deflection = Batch.DeflectionBonus.GetData();
+        const int32* RESTRICT Dodge = Batch.DodgeBonus.GetData();
+        const int32* RESTRICT Dex = Batch.DexterityModifier.GetData();
+        const int32* RESTRICT MaxDex = Batch.MaxDexBonus.GetData();
+        const int32* RESTRICT Size = Batch.SizeModifier.GetData();
+        const int32* RESTRICT Other = Batch.OtherModifiers.GetData();
+        int32* RESTRICT Total = OutResult.Total.GetData();
+        int32* RESTRICT Touch = OutResult.Touch.GetData();
+        int32* RESTRICT FlatFooted = OutResult.FlatFooted.GetData();
+
+        // Straight-line integer math with no branches so the compiler can vectorize the loop
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            const int32 DexBonus = FMath::Min(FMath::Max(0, Dex[Index]), MaxDex[Index]);
+            const int32 Common = Base[Index] + Size[Index] + Deflection[Index] + Other[Index];
+            const int32 Worn = Armor[Index] + Shield[Index] + Natural[Index];
+            const int32 Active = DexBonus + Dodge[Index];
+
+            Touch[Index] = Common + Active;
+            FlatFooted[Index] = Common + Worn;
+            Total[Index] = Common + Worn + Active;
+        }
+    }
+}
@@ -0,0 +1,63 @@
+// Copyright 2025 Surviving Gloomspire Team. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SGArmorClass.h"
+
+/**
+ * Structure-of-arrays input for evaluating the armor class of many combatants at once.
+ * Each array holds one entry per combatant; use Add to append a combatant and keep the arrays in step.
+ */
+struct SURVIVINGGLOOMSPIRE_API FSGArmorClassBatch
+{
+    TArray<int32> Base;
+    TArray<int32> ArmorBonus;
+    TArray<int32> ShieldBonus;
+    TArray<int32> NaturalArmor;
+    TArray<int32> DeflectionBonus;
+    TArray<int32> DodgeBonus;
+
+    /** Raw Dexterity modifier */
+    TArray<int32> DexterityModifier;
+
+    /** Armor's maximum Dexterity bonus, or FSGArmorClass::NoMaxDexBonus */
+    TArray<int32> MaxDexBonus;
+
+    TArray<int32> SizeModifier;
+
+    /** Untyped and other bonuses that apply to all three AC values */
+    TArray<int32> OtherModifiers;
+
+    /** Clears the batch while keeping its allocations */
+    void Reset(int32 ExpectedNum = 0);
+
+    /**
+     * Appends a combatant
+     * @return Index of the combatant in the batch and in the results
+     */
+    int32 Add(const FSGArmorClass& ArmorClass, int32 InDexterityModifier, int32 InSizeModifier = 0, int32 InOtherModifiers = 0);
+
+    int32 Num() const { return Base.Num(); }
+};
+
+/**
+ * Armor class values produced by SGCombat::EvaluateArmorClassBatch, one entry per combatant
+ */
+struct SURVIVINGGLOOMSPIRE_API FSGArmorClassBatchResult
+{
+    TArray<int32> Total;
+    TArray<int32> Touch;
+    TArray<int32> FlatFooted;
+};
+
+namespace SGCombat
+{
+    /**
+     * Computes total, touch and flat-footed AC for every combatant in a batch in a single pass.
+     * Matches FSGArmorClass::CalculateTotalAC, CalculateTouchAC and CalculateFlatFootedAC per entry.
+     * @param Batch The combatants to evaluate
+     * @param OutResult Resized to Batch.Num() and filled with the results
+     */
+    SURVIVINGGLOOMSPIRE_API void EvaluateArmorClassBatch(const FSGArmorClassBatch& Batch, FSGArmorClassBatchResult& OutResult);
+}
@@ -0,0 +1,139 @@
+// Copyright 2025 Surviving Gloomspire Team. All Rights Reserved.
+
+#include "SGDamageQueueSubsystem.h"
+#include "SGCharacterBase.h"
+#include "SGLog.h"
+
+namespace
+{
+    bool IsBloodied(const FSGHitPoints& HitPoints)
+    {
+        return HitPoints.Current * 2 <= HitPoints.Max;
+    }
+
+    bool IsDefeated(const FSGHitPoints& HitPoints)
+    {
+        return HitPoints.Current <= 0;
+    }
+}
+
+void USGDamageQueueSubsystem::QueueDamage(ASGCharacterBase* Target, int32 Amount)
+{
+    Enqueue(Target, Amount, false);
+}
+
+void USGDamageQueueSubsystem::QueueHealing(ASGCharacterBase* Target, int32 Amount)
+{
+    Enqueue(Target, Amount, true);
+}
+
+void USGDamageQueueSubsystem::Enqueue(ASGCharacterBase* Target, int32 Amount, bool bIsHealing)
+{
+    if (!Target || Amount <= 0)
+    {
+        return;
+    }
+
+    FQueuedChange& Queued = PendingChanges.AddDefaulted_GetRef();
+    Queued.Target = Target;
+    Queued.Change.Amount = Amount;
+    Queued.Change.bIsHealing = bIsHealing;
+}
+
+void USGDamageQueueSubsystem::Flush()
+{
+    if (PendingChanges.Num() == 0)
+    {
+        return;
+    }
+
+    // Listeners may queue more changes; those are resolved next flush
+    TArray<FQueuedChange> Queued = MoveTemp(PendingChanges);
+    PendingChanges.Reset();
+
+    // Group records by target, with targets in the order they were first queued and each target's records in
+    // the order they were queued, so events broadcast in the same order on every run. Targets destroyed since
+    // they were queued are dropped.
+    struct FTargetChanges
+    {
+        ASGCharacterBase* Target;
+        TArray<FSGHitPointChange, TInlineAllocator<4>> Changes;
+    };
+    TArray<FTargetChanges> Targets;
+    TMap<ASGCharacterBase*, int32> TargetIndices;
+    TargetIndices.Reserve(Queued.Num());
+
+    int32 NumResolved = 0;
+    for (const FQueuedChange& Change : Queued)
+    {
+        if (ASGCharacterBase* Target = Change.Target.Get())
+        {
+            int32& TargetIndex = TargetIndices.FindOrAdd(Target, INDEX_NONE);
+            if (TargetIndex == INDEX_NONE)
+            {
+                TargetIndex = Targets.Add({ Target });
+            }
+            Targets[TargetIndex].Changes.Add(Change.Change);
+            ++NumResolved;
+        }
+    }
+
+    DefeatedScratch.Reset();
+    ThresholdScratch.Reset();
+
+    for (const FTargetChanges& TargetChanges : Targets)
+    {
+        ASGCharacterBase* Target = TargetChanges.Target;
+        const FSGHitPoints Before = Target->ApplyHitPointChanges(TargetChanges.Changes);
+        const FSGHitPoints& After = Target->GetHitPoints();
+
+        auto CheckThreshold = [this, Target](ESGHitPointThreshold Threshold, bool bWas, bool bIs)
+        {
+            if (bWas != bIs)
+            {
+                FSGHitPointThresholdEvent& Event = ThresholdScratch.AddDefaulted_GetRef();
+                Event.Character = Target;
+                Event.Threshold = Threshold;
+                Event.bReached = bIs;
+            }
+        };
+
+        CheckThreshold(ESGHitPointThreshold::Bloodied, IsBloodied(Before), IsBloodied(After));
+        CheckThreshold(ESGHitPointThreshold::Defeated, IsDefeated(Before), IsDefeated(After));
+
+        if (!IsDefeated(Before) && IsDefeated(After))
+        {
+            DefeatedScratch.Add(Target);
+        }
+    }
+
+    UE_LOG(LogSGCharacter, Verbose, TEXT("SGDamageQueue: Resolved %d hit point changes, %d characters defeated"),
+        NumResolved, DefeatedScratch.Num());
+
+    if (ThresholdScratch.Num() > 0)
+    {
+        OnHitPointThresholdsCrossed.Broadcast(ThresholdScratch);
+    }
+
+    if (DefeatedScratch.Num() > 0)
+    {
+        OnCharactersDefeated.Broadcast(DefeatedScratch);
+    }
+}
+
+void USGDamageQueueSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+    Flush();
+}
+
+TStatId USGDamageQueueSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(USGDamageQueueSubsystem, STATGROUP_Tickables);
+}
+
+void USGDamageQueueSubsystem::Deinitialize()
+{
+    PendingChanges.Empty();
+    Super::Deinitialize();
+}
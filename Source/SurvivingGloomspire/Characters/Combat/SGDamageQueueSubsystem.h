@@ -0,0 +1,112 @@
+// Copyright 2025 Surviving Gloomspire Team. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SGHitPoints.h"
+#include "SGDamageQueueSubsystem.generated.h"
+
+class ASGCharacterBase;
+
+/**
+ * Hit point thresholds reported by the damage queue
+ */
+UENUM(BlueprintType)
+enum class ESGHitPointThreshold : uint8
+{
+    Bloodied    UMETA(DisplayName = "Bloodied"),    // At or below half of maximum hit points
+    Defeated    UMETA(DisplayName = "Defeated")     // At or below 0 hit points
+};
+
+/**
+ * A character crossing a hit point threshold during a damage queue flush
+ */
+USTRUCT(BlueprintType)
+struct FSGHitPointThresholdEvent
+{
+    GENERATED_BODY()
+
+    FSGHitPointThresholdEvent()
+        : Threshold(ESGHitPointThreshold::Bloodied)
+        , bReached(false)
+    {}
+
+    UPROPERTY(BlueprintReadOnly, Category = "Combat")
+    TObjectPtr<ASGCharacterBase> Character;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Combat")
+    ESGHitPointThreshold Threshold;
+
+    /** True if the character dropped to the threshold, false if it recovered above it */
+    UPROPERTY(BlueprintReadOnly, Category = "Combat")
+    bool bReached;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnCharactersDefeated, const TArray<ASGCharacterBase*>&, DefeatedCharacters);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnHitPointThresholdsCrossed, const TArray<FSGHitPointThresholdEvent>&, ThresholdEvents);
+
+/**
+ * Per-world queue of damage and healing.
+ * Records queued during a frame are resolved together at the next world tick: each target's records
+ * are applied in order in a single update (temporary hit points absorb damage first), then defeat and
+ * threshold events for every target are broadcast once as batches.
+ */
+UCLASS()
+class SURVIVINGGLOOMSPIRE_API USGDamageQueueSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * Queues damage against a character
+     * @param Target The character to damage
+     * @param Amount Damage to apply; non-positive amounts are ignored
+     */
+    UFUNCTION(BlueprintCallable, Category = "Combat|Damage")
+    void QueueDamage(ASGCharacterBase* Target, int32 Amount);
+
+    /**
+     * Queues healing for a character
+     * @param Target The character to heal
+     * @param Amount Healing to apply; non-positive amounts are ignored
+     */
+    UFUNCTION(BlueprintCallable, Category = "Combat|Damage")
+    void QueueHealing(ASGCharacterBase* Target, int32 Amount);
+
+    /** Resolves every queued record now instead of waiting for the next tick */
+    UFUNCTION(BlueprintCallable, Category = "Combat|Damage")
+    void Flush();
+
+    /** Gets the number of records waiting to be resolved */
+    int32 GetNumPending() const { return PendingChanges.Num(); }
+
+    /** Broadcast once per flush with every character defeated by it */
+    UPROPERTY(BlueprintAssignable, Category = "Combat|Damage")
+    FOnCharactersDefeated OnCharactersDefeated;
+
+    /** Broadcast once per flush with every threshold crossed during it */
+    UPROPERTY(BlueprintAssignable, Category = "Combat|Damage")
+    FOnHitPointThresholdsCrossed OnHitPointThresholdsCrossed;
+
+    //~ Begin UTickableWorldSubsystem Interface
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+    virtual void Deinitialize() override;
+    //~ End UTickableWorldSubsystem Interface
+
+private:
+    struct FQueuedChange
+    {
+        TWeakObjectPtr<ASGCharacterBase> Target;
+        FSGHitPointChange Change;
+    };
+
+    void Enqueue(ASGCharacterBase* Target, int32 Amount, bool bIsHealing);
+
+    TArray<FQueuedChange> PendingChanges;
+
+    /** Kept between flushes to avoid reallocating */
+    TArray<ASGCharacterBase*> DefeatedScratch;
+    TArray<FSGHitPointThresholdEvent> ThresholdScratch;
+};
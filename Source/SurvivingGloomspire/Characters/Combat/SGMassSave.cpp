@@ -0,0 +1,67 @@
+// Copyright 2025 Surviving Gloomspire Team. All Rights Reserved.
+
+#include "SGMassSave.h"
+#include "SGCharacterBase.h"
+
+namespace SGCombat
+{
+    void ResolveSaveBatch(TConstArrayView<int32> SaveBonuses, int32 DifficultyClass, FSGDiceStream& DiceStream, FSGMassSaveResult& OutResult)
+    {
+        const int32 Count = SaveBonuses.Num();
+        OutResult.NaturalRolls.SetNumUninitialized(Count, EAllowShrinking::No);
+        OutResult.Totals.SetNumUninitialized(Count, EAllowShrinking::No);
+        OutResult.Passed.Init(false, Count);
+        OutResult.Skipped.Init(false, Count);
+
+        int32* RESTRICT Rolls = OutResult.NaturalRolls.GetData();
+        int32* RESTRICT Totals = OutResult.Totals.GetData();
+        const int32* RESTRICT Bonuses = SaveBonuses.GetData();
+
+        // Draw every d20 up front in one bulk call
+        DiceStream.RollD20s(OutResult.NaturalRolls);
+
+        // Build the pass mask a word at a time
+        uint32* PassedWords = OutResult.Passed.GetData();
+        for (int32 WordStart = 0; WordStart < Count; WordStart += NumBitsPerDWORD)
+        {
+            const int32 WordEnd = FMath::Min(WordStart + NumBitsPerDWORD, Count);
+            uint32 Word = 0;
+            for (int32 Index = WordStart; Index < WordEnd; ++Index)
+            {
+                const int32 Roll = Rolls[Index];
+                const int32 Total = Roll + Bonuses[Index];
+                Totals[Index] = Total;
+
+                const bool bPassed = Roll != 1 && (Roll == 20 || Total >= DifficultyClass);
+                Word |= static_cast<uint32>(bPassed) << (Index - WordStart);
+            }
+            PassedWords[WordStart / NumBitsPerDWORD] = Word;
+        }
+    }
+
+    void ResolveMassSave(TConstArrayView<const ASGCharacterBase*> Targets, ESGSavingThrowType SaveType, int32 DifficultyClass, FSGDiceStream& DiceStream, FSGMassSaveResult& OutResult)
+    {
+        // Gather every bonus into a packed array before rolling anything
+        TArray<int32, TInlineAllocator<64>> SaveBonuses;
+        SaveBonuses.SetNumUninitialized(Targets.Num());
+        for (int32 Index = 0; Index < Targets.Num(); ++Index)
+        {
+            const ASGCharacterBase* Target = Targets[Index];
+            SaveBonuses[Index] = Target ? Target->GetSavingThrowTotal(SaveType) : 0;
+        }
+
+        ResolveSaveBatch(SaveBonuses, DifficultyClass, DiceStream, OutResult);
+
+        // Missing targets still draw a d20 so the stream stays in step, but report no roll and never pass
+        for (int32 Index = 0; Index < Targets.Num(); ++Index)
+        {
+            if (!Targets[Index])
+            {
+                OutResult.Passed[Index] = false;
+                OutResult.Skipped[Index] = true;
+                OutResult.NaturalRolls[Index] = 0;
+                OutResult.Totals[Index] = 0;
+            }
+        }
+    }
+}
@@ -0,0 +1,57 @@
+// Copyright 2025 Surviving Gloomspire Team. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/BitArray.h"
+#include "SGDiceStream.h"
+#include "SGSavingThrows.h"
+
+class ASGCharacterBase;
+
+/**
+ * Outcome of a saving throw made by a list of targets, one entry per target in the order given
+ */
+struct SURVIVINGGLOOMSPIRE_API FSGMassSaveResult
+{
+    /** Bit per target that succeeded on its save */
+    TBitArray<> Passed;
+
+    /** Bit per target that was missing and made no save; its Passed bit is clear and its roll and total are 0 */
+    TBitArray<> Skipped;
+
+    /** Natural d20 roll of each target, for the combat log */
+    TArray<int32> NaturalRolls;
+
+    /** Roll plus save bonus of each target */
+    TArray<int32> Totals;
+
+    int32 Num() const { return NaturalRolls.Num(); }
+
+    int32 CountPassed() const { return Passed.CountSetBits(); }
+};
+
+namespace SGCombat
+{
+    /**
+     * Rolls a saving throw for every entry of a packed bonus array.
+     * All d20s are drawn from the stream in one bulk call first, then totals and the pass mask are computed in one pass.
+     * A natural 20 always succeeds and a natural 1 always fails.
+     * @param SaveBonuses Total save bonus of each target
+     * @param DifficultyClass DC of the effect
+     * @param DiceStream Stream the d20s are drawn from
+     * @param OutResult Filled with one entry per bonus
+     */
+    SURVIVINGGLOOMSPIRE_API void ResolveSaveBatch(TConstArrayView<int32> SaveBonuses, int32 DifficultyClass, FSGDiceStream& DiceStream, FSGMassSaveResult& OutResult);
+
+    /**
+     * Resolves one saving throw for a whole target list, e.g. everything caught in a fireball.
+     * Save bonuses are read from each target's cached derived stats; null targets are marked skipped and never pass.
+     * @param Targets Characters making the save
+     * @param SaveType The saving throw to make
+     * @param DifficultyClass DC of the effect
+     * @param DiceStream Stream the d20s are drawn from
+     * @param OutResult Filled with one entry per target
+     */
+    SURVIVINGGLOOMSPIRE_API void ResolveMassSave(TConstArrayView<const ASGCharacterBase*> Targets, ESGSavingThrowType SaveType, int32 DifficultyClass, FSGDiceStream& DiceStream, FSGMassSaveResult& OutResult);
+}
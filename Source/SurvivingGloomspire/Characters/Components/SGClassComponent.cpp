@@ -2,6 +2,10 @@
 
 #include "SGClassComponent.h"
 #include "SGCharacterClassData.h"
+#include "SGCharacterBase.h"
+#include "SGRulesTables.h"
+#include "SGLog.h"
+#include "SGTrace.h"
 
 USGClassComponent::USGClassComponent()
 {
@@ -15,11 +19,22 @@ void USGClassComponent::BeginPlay()
     
     OwnerCharacter = GetOwner();
     
+    // Features need the class assets; until they load only the level bookkeeping happens
+    USGClassRegistry* Registry = USGClassRegistry::Get(this);
+    if (Registry && !Registry->IsLoaded())
+    {
+        Registry->OnClassesLoaded.AddUniqueDynamic(this, &USGClassComponent::HandleClassesLoaded);
+    }
+    
     // Initialize with level 1 in a default class if no levels exist
     if (ClassLevels.Num() == 0)
     {
         AddClassLevel(ESGClassType::Fighter);
     }
+    else
+    {
+        ApplyClassFeatures();
+    }
 }
 
 bool USGClassComponent::AddExperience(int32 Amount)
@@ -29,29 +44,19 @@ bool USGClassComponent::AddExperience(int32 Amount)
         return false;
     }
     
-    const int32 OldXP = CurrentXP;
     CurrentXP += Amount;
     
     // Notify that experience was gained
     OnExperienceGained.Broadcast(GetOwner(), Amount, CurrentXP);
     
-    // Check for level up
-    bool bLeveledUp = false;
-    while (GetXPForNextLevel() > 0 && CurrentXP >= GetXPForNextLevel())
+    // Gain every level the new total reaches in one step
+    if (ClassLevels.Num() == 0)
     {
-        // Add a level in the highest class
-        if (ClassLevels.Num() > 0)
-        {
-            AddClassLevel(ClassLevels[0].ClassType);
-            bLeveledUp = true;
-        }
-        else
-        {
-            break;
-        }
+        return false;
     }
-    
-    return bLeveledUp;
+
+    const int32 LevelsGained = SGRules::GetLevelForXP(CurrentXP) - GetTotalLevels();
+    return LevelsGained > 0 && AddClassLevels(ClassLevels[0].ClassType, LevelsGained);
 }
 
 int32 USGClassComponent::GetXPForNextLevel() const
@@ -66,37 +71,113 @@ int32 USGClassComponent::GetCharacterLevel() const
 
 bool USGClassComponent::AddClassLevel(ESGClassType ClassType, bool bAllowMulticlass)
 {
+    return AddClassLevels(ClassType, 1, bAllowMulticlass);
+}
+
+bool USGClassComponent::AddClassLevels(ESGClassType ClassType, int32 NumLevels, bool bAllowMulticlass)
+{
+    if (NumLevels <= 0)
+    {
+        return false;
+    }
+
     // Check if we can add a level in this class
     if (!bAllowMulticlass && ClassLevels.Num() > 0 && ClassLevels[0].ClassType != ClassType)
     {
         return false;
     }
     
+    const int32 OldCharacterLevel = GetTotalLevels();
+
     // Find or add the class level entry
     FSGCharacterClassLevel* ClassLevel = ClassLevels.FindByPredicate(
         [ClassType](const FSGCharacterClassLevel& Level) { return Level.ClassType == ClassType; });
     
-    if (ClassLevel)
+    if (!ClassLevel)
+    {
+        FSGCharacterClassLevel NewClassLevel;
+        NewClassLevel.ClassType = ClassType;
+        NewClassLevel.Level = 0;
+        ClassLevel = &ClassLevels.Add_GetRef(NewClassLevel);
+    }
+    
+    const int32 OldClassLevel = ClassLevel->Level;
+    ClassLevel->Level += NumLevels;
+    const int32 NewCharacterLevel = OldCharacterLevel + NumLevels;
+    
+    // Apply only the features the new class levels grant, in the order they were gained
+    for (int32 Level = OldClassLevel + 1; Level <= OldClassLevel + NumLevels; ++Level)
+    {
+        ApplyClassLevelFeatures(ClassType, Level);
+        SG_TRACE(LevelUp, GetOwner(), static_cast<int32>(ClassType), OldCharacterLevel + Level - OldClassLevel);
+    }
+    
+    // Hit points, saves and skills all depend on class levels
+    if (ASGCharacterBase* Character = Cast<ASGCharacterBase>(GetOwner()))
+    {
+        Character->InvalidateDerivedStats(ESGDerivedInput::ClassLevels);
+    }
+    
+    UE_LOG(LogSGClasses, Verbose, TEXT("%s gained %d level(s) in %s (character level %d -> %d)"),
+        *GetNameSafe(GetOwner()), NumLevels, *GetClassTypeAsString(ClassType), OldCharacterLevel, NewCharacterLevel);
+    
+    // Notify about the level up once for the whole range
+    OnLevelsGained.Broadcast(GetOwner(), ClassType, OldCharacterLevel, NewCharacterLevel);
+    OnLevelUp.Broadcast(GetOwner(), ClassType, NewCharacterLevel);
+    
+    return true;
+}
+
+bool USGClassComponent::RemoveClassLevels(ESGClassType ClassType, int32 NumLevels)
+{
+    const int32 ClassIndex = ClassLevels.IndexOfByPredicate(
+        [ClassType](const FSGCharacterClassLevel& Level) { return Level.ClassType == ClassType; });
+    if (NumLevels <= 0 || ClassIndex == INDEX_NONE)
+    {
+        return false;
+    }
+    
+    const int32 OldCharacterLevel = GetTotalLevels();
+    const int32 LevelsRemoved = FMath::Min(NumLevels, ClassLevels[ClassIndex].Level);
+    const int32 NewClassLevel = ClassLevels[ClassIndex].Level - LevelsRemoved;
+    
+    // Remove only the features the lost levels unlocked
+    SyncClassFeatures(ClassType, NewClassLevel);
+    
+    if (NewClassLevel > 0)
     {
-        ClassLevel->Level++;
+        ClassLevels[ClassIndex].Level = NewClassLevel;
     }
     else
     {
-        FSGCharacterClassLevel NewClassLevel;
-        NewClassLevel.ClassType = ClassType;
-        NewClassLevel.Level = 1;
-        ClassLevels.Add(NewClassLevel);
+        ClassLevels.RemoveAt(ClassIndex);
     }
     
-    // Apply features for the new level
-    ApplyClassFeatures();
+    if (ASGCharacterBase* Character = Cast<ASGCharacterBase>(GetOwner()))
+    {
+        Character->InvalidateDerivedStats(ESGDerivedInput::ClassLevels);
+    }
     
-    // Notify about the level up
-    OnLevelUp.Broadcast(GetOwner(), ClassType, GetCharacterLevel());
+    UE_LOG(LogSGClasses, Verbose, TEXT("%s lost %d level(s) in %s (character level %d -> %d)"),
+        *GetNameSafe(GetOwner()), LevelsRemoved, *GetClassTypeAsString(ClassType), OldCharacterLevel, OldCharacterLevel - LevelsRemoved);
     
     return true;
 }
 
+void USGClassComponent::SetClassLevels(const TArray<FSGCharacterClassLevel>& NewClassLevels)
+{
+    ClassLevels = NewClassLevels;
+    ApplyClassFeatures();
+    
+    if (ASGCharacterBase* Character = Cast<ASGCharacterBase>(GetOwner()))
+    {
+        Character->InvalidateDerivedStats(ESGDerivedInput::ClassLevels);
+    }
+    
+    UE_LOG(LogSGClasses, Verbose, TEXT("%s class levels replaced (character level %d)"),
+        *GetNameSafe(GetOwner()), GetTotalLevels());
+}
+
 int32 USGClassComponent::GetTotalLevels() const
 {
     int32 TotalLevels = 0;
@@ -107,61 +188,149 @@ int32 USGClassComponent::GetTotalLevels() const
     return TotalLevels;
 }
 
-int32 USGClassComponent::GetBaseAttackBonus() const
+FSGClassProgressionTotals USGClassComponent::GetProgressionTotals() const
 {
-    // TODO: Implement actual BAB calculation based on class levels
-    // For now, return a simple 1:1 BAB progression
-    return GetTotalLevels();
+    if (const USGClassRegistry* Registry = USGClassRegistry::Get(this))
+    {
+        return Registry->GetProgressionTotals(ClassLevels);
+    }
+    return USGClassRegistry::GetDefaultProgressionTotals(ClassLevels);
 }
 
 int32 USGClassComponent::CalculateXPForLevel(int32 Level)
 {
-    if (Level <= 1)
+    // Standard Pathfinder XP progression
+    return SGRules::GetXPForLevel(Level);
+}
+
+const USGClassRegistry* USGClassComponent::GetLoadedClassRegistry() const
+{
+    const USGClassRegistry* Registry = USGClassRegistry::Get(this);
+    return Registry && Registry->IsLoaded() ? Registry : nullptr;
+}
+
+void USGClassComponent::HandleClassesLoaded(int32 NumClasses)
+{
+    if (USGClassRegistry* Registry = USGClassRegistry::Get(this))
     {
-        return 0;
+        Registry->OnClassesLoaded.RemoveDynamic(this, &USGClassComponent::HandleClassesLoaded);
     }
     
-    // Standard Pathfinder XP progression
-    static const TArray<int32> XPTable = {
-        0,       // Level 1
-        2000,    // 2
-        5000,    // 3
-        9000,    // 4
-        15000,   // 5
-        23000,   // 6
-        35000,   // 7
-        51000,   // 8
-        75000,   // 9
-        105000,  // 10
-        155000,  // 11
-        220000,  // 12
-        315000,  // 13
-        445000,  // 14
-        635000,  // 15
-        890000,  // 16
-        1300000, // 17
-        1800000, // 18
-        2550000, // 19
-        3600000  // 20
-    };
-    
-    if (Level <= XPTable.Num())
-    {
-        return XPTable[Level - 1];
-    }
-    
-    // For levels beyond the table, add 1,000,000 XP per level
-    return XPTable.Last() + (Level - XPTable.Num()) * 1000000;
+    // Levels gained while loading applied no features, so catch every class up at once
+    ApplyClassFeatures();
 }
 
 void USGClassComponent::ApplyClassFeatures()
 {
-    // TODO: Implement feature application
-    // This would apply all features from all class levels
+    int32 LevelsByClass[SGClassTypeCount] = {};
+    for (const FSGCharacterClassLevel& ClassLevel : ClassLevels)
+    {
+        const int32 ClassIndex = static_cast<int32>(ClassLevel.ClassType);
+        if (ClassIndex < SGClassTypeCount)
+        {
+            LevelsByClass[ClassIndex] += ClassLevel.Level;
+        }
+    }
+    
+    // Classes the character no longer has sync to level 0, which removes all of their features
+    for (int32 ClassIndex = 0; ClassIndex < SGClassTypeCount; ++ClassIndex)
+    {
+        if (LevelsByClass[ClassIndex] > 0 || ActiveClassFeatures[ClassIndex].Contains(true))
+        {
+            SyncClassFeatures(static_cast<ESGClassType>(ClassIndex), LevelsByClass[ClassIndex]);
+        }
+    }
 }
 
-void USGClassComponent::ApplyClassFeature(const FSGClassFeature& Feature)
+void USGClassComponent::ApplyClassLevelFeatures(ESGClassType ClassType, int32 ClassLevel)
 {
-    // TODO: Implement feature application logic
-    // This would handle applying the actual game effects of the feature
+    const USGClassRegistry* Registry = GetLoadedClassRegistry();
+    if (!Registry)
+    {
+        return;
+    }
+    
+    const TConstArrayView<const FSGClassFeature*> Features = Registry->GetClassFeatures(ClassType);
+    const TConstArrayView<const FSGClassFeaturePayload*> Payloads = Registry->GetClassFeaturePayloads(ClassType);
+    TBitArray<>& Active = ActiveClassFeatures[static_cast<uint8>(ClassType)];
+    TArray<FSGModifierHandle>& Modifiers = ClassFeatureModifiers[static_cast<uint8>(ClassType)];
+    if (Active.Num() < Features.Num())
+    {
+        Active.Add(false, Features.Num() - Active.Num());
+        Modifiers.SetNum(Features.Num());
+    }
+    
+    // Features are ordered by unlock level, so this level's features are one contiguous range
+    const int32 EndIndex = Registry->GetNumFeaturesUnlocked(ClassType, ClassLevel);
+    for (int32 Index = Registry->GetNumFeaturesUnlocked(ClassType, ClassLevel - 1); Index < EndIndex; ++Index)
+    {
+        if (!Active[Index])
+        {
+            ApplyClassFeature(*Features[Index], *Payloads[Index], Modifiers[Index]);
+            Active[Index] = true;
+        }
+    }
+}
+
+void USGClassComponent::SyncClassFeatures(ESGClassType ClassType, int32 ClassLevel)
+{
+    const USGClassRegistry* Registry = GetLoadedClassRegistry();
+    if (!Registry)
+    {
+        return;
+    }
+    
+    const TConstArrayView<const FSGClassFeature*> Features = Registry->GetClassFeatures(ClassType);
+    const TConstArrayView<const FSGClassFeaturePayload*> Payloads = Registry->GetClassFeaturePayloads(ClassType);
+    TBitArray<>& Active = ActiveClassFeatures[static_cast<uint8>(ClassType)];
+    TArray<FSGModifierHandle>& Modifiers = ClassFeatureModifiers[static_cast<uint8>(ClassType)];
+    if (Active.Num() < Features.Num())
+    {
+        Active.Add(false, Features.Num() - Active.Num());
+        Modifiers.SetNum(Features.Num());
+    }
+    
+    const int32 NumUnlocked = Registry->GetNumFeaturesUnlocked(ClassType, ClassLevel);
+    
+    // Remove lost features newest first, the reverse of the order they were applied
+    for (int32 Index = Features.Num() - 1; Index >= NumUnlocked; --Index)
+    {
+        if (Active[Index])
+        {
+            RemoveClassFeature(*Features[Index], Modifiers[Index]);
+            Active[Index] = false;
+        }
+    }
+    
+    for (int32 Index = 0; Index < NumUnlocked; ++Index)
+    {
+        if (!Active[Index])
+        {
+            ApplyClassFeature(*Features[Index], *Payloads[Index], Modifiers[Index]);
+            Active[Index] = true;
+        }
+    }
+}
+
+void USGClassComponent::ApplyClassFeature(const FSGClassFeature& Feature, const FSGClassFeaturePayload& Payload, FSGModifierHandle& OutModifier)
+{
+    ASGCharacterBase* Character = Cast<ASGCharacterBase>(GetOwner());
+    if (Character && Payload.bHasModifier)
+    {
+        OutModifier = Character->AddModifier(Feature.FeatureName, Payload.BonusType, Payload.Target, Payload.Bonus, Payload.SkillType);
+    }
+    
+    UE_LOG(LogSGClasses, Verbose, TEXT("%s gained class feature %s"), *GetNameSafe(GetOwner()), *Feature.FeatureName.ToString());
+}
+
+void USGClassComponent::RemoveClassFeature(const FSGClassFeature& Feature, FSGModifierHandle& Modifier)
+{
+    ASGCharacterBase* Character = Cast<ASGCharacterBase>(GetOwner());
+    if (Character && Modifier.IsValid())
+    {
+        Character->RemoveModifier(Modifier);
+    }
+    Modifier = FSGModifierHandle();
+    
+    UE_LOG(LogSGClasses, Verbose, TEXT("%s lost class feature %s"), *GetNameSafe(GetOwner()), *Feature.FeatureName.ToString());
 }
@@ -5,11 +5,15 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "SGCharacterClass.h"
+#include "SGClassRegistry.h"
 #include "SGClassComponent.generated.h"
 
 // Delegate for when a character gains a level
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnCharacterLevelUp, AActor*, Character, ESGClassType, ClassType, int32, NewLevel);
 
+// Delegate for when a character gains one or more levels in a single step
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FOnCharacterLevelsGained, AActor*, Character, ESGClassType, ClassType, int32, OldLevel, int32, NewLevel);
+
 // Delegate for when a character gains experience
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnExperienceGained, AActor*, Character, int32, ExperienceGained, int32, NewTotal);
 
@@ -25,7 +29,8 @@ public:
     USGClassComponent();
 
     /**
-     * Add experience points to the character
+     * Add experience points to the character. Every level the new total reaches is gained in one step,
+     * so a large award raises the character several levels with a single progression event.
      * @param Amount Amount of XP to add
      * @return True if the character leveled up
      */
@@ -64,6 +69,47 @@ public:
      */
     UFUNCTION(BlueprintCallable, Category = "Character|Progression")
     bool AddClassLevel(ESGClassType ClassType, bool bAllowMulticlass = false);
+
+    /**
+     * Add several levels in the specified class at once.
+     * Features are applied only for the class levels gained, in order, derived stats are invalidated once,
+     * and OnLevelsGained and OnLevelUp are each broadcast once for the whole range.
+     * @param ClassType The class to level up in
+     * @param NumLevels How many levels to add
+     * @param bAllowMulticlass Whether to allow multiclassing
+     * @return True if the levels were added successfully
+     */
+    UFUNCTION(BlueprintCallable, Category = "Character|Progression")
+    bool AddClassLevels(ESGClassType ClassType, int32 NumLevels, bool bAllowMulticlass = false);
+
+    /**
+     * Remove levels from the specified class, e.g. for level drain or a respec.
+     * Only the features the removed levels unlocked are removed.
+     * @param ClassType The class to lose levels in
+     * @param NumLevels How many levels to remove; the class is dropped when it reaches zero
+     * @return True if any levels were removed
+     */
+    UFUNCTION(BlueprintCallable, Category = "Character|Progression")
+    bool RemoveClassLevels(ESGClassType ClassType, int32 NumLevels);
+
+    /**
+     * Replace the character's class levels, e.g. for a respec.
+     * Features both builds share stay applied; only the difference is removed or applied.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Character|Progression")
+    void SetClassLevels(const TArray<FSGCharacterClassLevel>& NewClassLevels);
+
+    /**
+     * Whether a class feature is currently applied to the character
+     * @param ClassType The class granting the feature
+     * @param FeatureIndex The feature's index in USGClassRegistry::GetClassFeatures
+     */
+    bool IsClassFeatureActive(ESGClassType ClassType, int32 FeatureIndex) const
+    {
+        const int32 ClassIndex = static_cast<int32>(ClassType);
+        return ClassIndex < SGClassTypeCount && FeatureIndex >= 0 && FeatureIndex < ActiveClassFeatures[ClassIndex].Num()
+            && ActiveClassFeatures[ClassIndex][FeatureIndex];
+    }
     
     /**
      * Get the total number of levels the character has
@@ -75,13 +121,31 @@ public:
      * Get the character's base attack bonus from all classes
      */
     UFUNCTION(BlueprintPure, Category = "Character|Progression")
-    int32 GetBaseAttackBonus() const;
+    int32 GetBaseAttackBonus() const { return GetProgressionTotals().BaseAttackBonus; }
+
+    /**
+     * Get the character's base save from all classes
+     */
+    UFUNCTION(BlueprintPure, Category = "Character|Progression")
+    int32 GetBaseSave(ESGSavingThrowType SaveType) const { return GetProgressionTotals().GetBaseSave(SaveType); }
+
+    /**
+     * Get the base attack bonus, saves, skill ranks and hit dice accumulated from all classes
+     */
+    UFUNCTION(BlueprintPure, Category = "Character|Progression")
+    FSGClassProgressionTotals GetProgressionTotals() const;
     
     /**
-     * Called when the character gains a level
+     * Called when the character gains a level; once with the final level when several are gained together
      */
     UPROPERTY(BlueprintAssignable, Category = "Character|Progression")
     FOnCharacterLevelUp OnLevelUp;
+
+    /**
+     * Called once per level gain with the character level before and after, however many levels were gained
+     */
+    UPROPERTY(BlueprintAssignable, Category = "Character|Progression")
+    FOnCharacterLevelsGained OnLevelsGained;
     
     /**
      * Called when the character gains experience
@@ -99,14 +163,38 @@ protected:
     static int32 CalculateXPForLevel(int32 Level);
     
     /**
-     * Apply features from the character's class levels
+     * Bring every class's applied features in line with the character's class levels, e.g. after loading or a respec
      */
     void ApplyClassFeatures();
     
+    /**
+     * Apply the features a class grants at one class level that are not already active
+     * @param ClassType The class that gained the level
+     * @param ClassLevel The new level in that class
+     */
+    void ApplyClassLevelFeatures(ESGClassType ClassType, int32 ClassLevel);
+
+    /**
+     * Apply the features a class level unlocks that are not active, and remove active ones it does not unlock
+     * @param ClassType The class to update
+     * @param ClassLevel Levels the character now has in that class
+     */
+    void SyncClassFeatures(ESGClassType ClassType, int32 ClassLevel);
+
     /**
      * Apply a single class feature
+     * @param Feature The feature
+     * @param Payload The feature's compiled data
+     * @param OutModifier Receives the modifier the feature added, if any
+     */
+    void ApplyClassFeature(const FSGClassFeature& Feature, const FSGClassFeaturePayload& Payload, FSGModifierHandle& OutModifier);
+
+    /**
+     * Remove a single class feature applied by ApplyClassFeature
+     * @param Feature The feature
+     * @param Modifier The modifier ApplyClassFeature added; reset on return
      */
-    void ApplyClassFeature(const FSGClassFeature& Feature);
+    void RemoveClassFeature(const FSGClassFeature& Feature, FSGModifierHandle& Modifier);
 
 private:
     /** Current experience points */
@@ -117,6 +205,19 @@ private:
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Character|Progression", meta = (AllowPrivateAccess = "true"))
     TArray<FSGCharacterClassLevel> ClassLevels;
     
+    /** Bit per applied class feature indexed by ESGClassType, in USGClassRegistry::GetClassFeatures order */
+    TBitArray<> ActiveClassFeatures[SGClassTypeCount];
+
+    /** Modifier added by each applied class feature, in the same layout as ActiveClassFeatures */
+    TArray<FSGModifierHandle> ClassFeatureModifiers[SGClassTypeCount];
+
+    /** Gets the class registry, or null if there is none or its initial load has not finished */
+    const USGClassRegistry* GetLoadedClassRegistry() const;
+
+    /** Applies the features of every class level gained before the class assets loaded */
+    UFUNCTION()
+    void HandleClassesLoaded(int32 NumClasses);
+
     /** Cached pointer to the owning character */
     UPROPERTY()
     TWeakObjectPtr<AActor> OwnerCharacter;
@@ -2,8 +2,11 @@
 
 #include "SGFeatComponent.h"
 #include "SGFeatData.h"
+#include "SGFeatRegistry.h"
 #include "SGFeatTypes.h"
 #include "SGCharacterBase.h"
+#include "SGLog.h"
+#include "SGTrace.h"
 
 USGFeatComponent::USGFeatComponent()
 {
@@ -21,30 +24,32 @@ void USGFeatComponent::BeginPlay()
     }
 }
 
+void USGFeatComponent::PostLoad()
+{
+    Super::PostLoad();
+    RebuildFeatLookup();
+}
+
 void USGFeatComponent::Initialize(ASGCharacterBase* InOwnerCharacter)
 {
     if (!InOwnerCharacter)
     {
-        UE_LOG(LogTemp, Warning, TEXT("SGFeatComponent: Invalid owner character"));
+        UE_LOG(LogSGFeats, Warning, TEXT("SGFeatComponent: Invalid owner character"));
         return;
     }
 
     OwnerCharacter = InOwnerCharacter;
-    UE_LOG(LogTemp, Log, TEXT("SGFeatComponent: Initialized for %s"), *GetNameSafe(OwnerCharacter.Get()));
-}
-
-bool USGFeatComponent::HasFeat(ESGFeatType FeatType) const
-{
-    return FindFeatInstance(FeatType) != nullptr;
-}
+    RebuildFeatLookup();
+    ReapplyAllBenefits();
 
-int32 USGFeatComponent::GetFeatStackCount(ESGFeatType FeatType) const
-{
-    if (const FSGFeatInstance* FeatInstance = FindFeatInstance(FeatType))
+    // Feat data arrives asynchronously; benefits and eligibility are filled in once it has
+    USGFeatRegistry* Registry = USGFeatRegistry::Get(this);
+    if (Registry && !Registry->IsLoaded())
     {
-        return FeatInstance->StackCount;
+        Registry->OnFeatsLoaded.AddUniqueDynamic(this, &USGFeatComponent::HandleFeatsLoaded);
     }
-    return 0;
+
+    UE_LOG(LogSGFeats, Verbose, TEXT("SGFeatComponent: Initialized for %s"), *GetNameSafe(OwnerCharacter.Get()));
 }
 
 bool USGFeatComponent::AddFeat(ESGFeatType FeatType, bool bCheckPrerequisites)
@@ -63,13 +68,34 @@ bool USGFeatComponent::AddFeat(ESGFeatType FeatType, bool bCheckPrerequisites)
             if (ExistingFeat->StackCount < ExistingFeat->FeatData->MaxStackCount)
             {
                 ExistingFeat->StackCount++;
-                ExistingFeat->FeatData->ApplyBenefits(OwnerCharacter.Get(), ExistingFeat->StackCount);
+                FeatStackCounts[static_cast<uint8>(FeatType)] = ExistingFeat->StackCount;
+                ApplyBenefitStack(FeatType, ExistingFeat->StackCount);
+                OwnerCharacter->InvalidateDerivedStats(ESGDerivedInput::Feats);
+                SG_TRACE(FeatAdded, OwnerCharacter.Get(), static_cast<int32>(FeatType), ExistingFeat->StackCount);
                 return true;
             }
         }
         return false;
     }
 
+    // Prerequisites and stacking rules live in the feat data, so until it has loaded only unchecked grants
+    // (e.g. from a class or a save) are accepted; their benefits are applied once the data arrives
+    const USGFeatRegistry* Registry = USGFeatRegistry::Get(this);
+    if (Registry && !Registry->IsLoaded())
+    {
+        if (bCheckPrerequisites || FeatType >= ESGFeatType::MAX)
+        {
+            UE_LOG(LogSGFeats, Verbose, TEXT("SGFeatComponent: Feat data not loaded yet, cannot check feat %d"), static_cast<int32>(FeatType));
+            return false;
+        }
+
+        Feats.Add(FSGFeatInstance(FeatType, nullptr));
+        OwnedFeatMask |= SGFeats::Bit(FeatType);
+        FeatStackCounts[static_cast<uint8>(FeatType)] = 1;
+        SG_TRACE(FeatAdded, OwnerCharacter.Get(), static_cast<int32>(FeatType), 1);
+        return true;
+    }
+
     // Check prerequisites if needed
     if (bCheckPrerequisites && !MeetsPrerequisites(FeatType))
     {
@@ -77,15 +103,27 @@ bool USGFeatComponent::AddFeat(ESGFeatType FeatType, bool bCheckPrerequisites)
     }
 
     // Create a new feat instance
-    if (USGFeatData* FeatData = GetFeatData(FeatType))
+    if (const USGFeatData* FeatData = GetFeatData(FeatType))
     {
         FSGFeatInstance NewFeat(FeatType, FeatData);
         Feats.Add(NewFeat);
+        OwnedFeatMask |= SGFeats::Bit(FeatType);
+        FeatStackCounts[static_cast<uint8>(FeatType)] = NewFeat.StackCount;
+        if (FeatData->FeatCategory < ESGFeatCategory::MAX)
+        {
+            CategoryFeatMasks[static_cast<uint8>(FeatData->FeatCategory)] |= SGFeats::Bit(FeatType);
+        }
+        
+        FSGPrerequisiteInputChange Change;
+        Change.Feats = SGFeats::Bit(FeatType);
+        InvalidateFeatEligibility(Change);
         
         // Apply the feat's benefits
-        FeatData->ApplyBenefits(OwnerCharacter.Get());
+        ApplyBenefitStack(FeatType, 1);
+        OwnerCharacter->InvalidateDerivedStats(ESGDerivedInput::Feats);
         
-        UE_LOG(LogTemp, Log, TEXT("Added feat %s to %s"), 
+        SG_TRACE(FeatAdded, OwnerCharacter.Get(), static_cast<int32>(FeatType), 1);
+        UE_LOG(LogSGFeats, Verbose, TEXT("Added feat %s to %s"), 
             *FeatData->DisplayName.ToString(), 
             *GetNameSafe(OwnerCharacter.Get()));
             
@@ -97,7 +135,7 @@ bool USGFeatComponent::AddFeat(ESGFeatType FeatType, bool bCheckPrerequisites)
 
 bool USGFeatComponent::RemoveFeat(ESGFeatType FeatType)
 {
-    if (!OwnerCharacter.IsValid())
+    if (!OwnerCharacter.IsValid() || !HasFeat(FeatType))
     {
         return false;
     }
@@ -107,12 +145,21 @@ bool USGFeatComponent::RemoveFeat(ESGFeatType FeatType)
         if (Feats[i].FeatType == FeatType)
         {
             // Remove the feat's benefits before removing it
-            if (Feats[i].FeatData)
+            UndoAllBenefits(FeatType);
+            
+            Feats.RemoveAt(i);
+            OwnedFeatMask &= ~SGFeats::Bit(FeatType);
+            FeatStackCounts[static_cast<uint8>(FeatType)] = 0;
+            for (uint64& CategoryMask : CategoryFeatMasks)
             {
-                Feats[i].FeatData->RemoveBenefits(OwnerCharacter.Get());
+                CategoryMask &= ~SGFeats::Bit(FeatType);
             }
             
-            Feats.RemoveAt(i);
+            FSGPrerequisiteInputChange Change;
+            Change.Feats = SGFeats::Bit(FeatType);
+            InvalidateFeatEligibility(Change);
+            OwnerCharacter->InvalidateDerivedStats(ESGDerivedInput::Feats);
+            SG_TRACE(FeatRemoved, OwnerCharacter.Get(), static_cast<int32>(FeatType));
             return true;
         }
     }
@@ -120,6 +167,101 @@ bool USGFeatComponent::RemoveFeat(ESGFeatType FeatType)
     return false;
 }
 
+bool USGFeatComponent::RemoveFeatStack(ESGFeatType FeatType)
+{
+    FSGFeatInstance* FeatInstance = OwnerCharacter.IsValid() ? FindFeatInstance(FeatType) : nullptr;
+    if (!FeatInstance)
+    {
+        return false;
+    }
+
+    if (FeatInstance->StackCount <= 1)
+    {
+        return RemoveFeat(FeatType);
+    }
+
+    UndoBenefitStack(FeatType);
+    FeatInstance->StackCount--;
+    FeatStackCounts[static_cast<uint8>(FeatType)] = FeatInstance->StackCount;
+    OwnerCharacter->InvalidateDerivedStats(ESGDerivedInput::Feats);
+    return true;
+}
+
+void USGFeatComponent::ApplyBenefitStack(ESGFeatType FeatType, int32 StackNumber)
+{
+    // Before the feat data loads there is nothing to apply; HandleFeatsLoaded applies every owned feat then
+    const USGFeatData* FeatData = GetFeatData(FeatType);
+    const USGFeatRegistry* Registry = FeatData ? USGFeatRegistry::Get(this) : nullptr;
+    if (!OwnerCharacter.IsValid() || !Registry)
+    {
+        return;
+    }
+
+    const TConstArrayView<FSGFeatEffect> Effects = Registry->GetBenefitEffects(FeatType);
+    FSGFeatBenefitJournal& Journal = BenefitJournals[static_cast<uint8>(FeatType)];
+    Journal.HandlesPerStack = Effects.Num();
+
+    // Each stack is its own source so stacking bonus types from repeated feats add up
+    const FName Source(FeatData->GetFName(), StackNumber);
+    for (const FSGFeatEffect& Effect : Effects)
+    {
+        Journal.Handles.Add(OwnerCharacter->AddModifier(Source, Effect.BonusType, Effect.Target, Effect.Value, Effect.SkillType));
+    }
+}
+
+void USGFeatComponent::UndoBenefitStack(ESGFeatType FeatType)
+{
+    FSGFeatBenefitJournal& Journal = BenefitJournals[static_cast<uint8>(FeatType)];
+    const int32 NumToUndo = FMath::Min(Journal.HandlesPerStack, Journal.Handles.Num());
+    for (int32 Undone = 0; Undone < NumToUndo; ++Undone)
+    {
+        const FSGModifierHandle Handle = Journal.Handles.Pop(EAllowShrinking::No);
+        if (OwnerCharacter.IsValid())
+        {
+            OwnerCharacter->RemoveModifier(Handle);
+        }
+    }
+}
+
+void USGFeatComponent::UndoAllBenefits(ESGFeatType FeatType)
+{
+    FSGFeatBenefitJournal& Journal = BenefitJournals[static_cast<uint8>(FeatType)];
+    if (OwnerCharacter.IsValid())
+    {
+        for (int32 Index = Journal.Handles.Num() - 1; Index >= 0; --Index)
+        {
+            OwnerCharacter->RemoveModifier(Journal.Handles[Index]);
+        }
+    }
+    Journal.Handles.Reset();
+    Journal.HandlesPerStack = 0;
+}
+
+void USGFeatComponent::ReapplyAllBenefits()
+{
+    for (int32 Index = 0; Index < SGFeatCount; ++Index)
+    {
+        UndoAllBenefits(static_cast<ESGFeatType>(Index));
+    }
+
+    // Nothing to apply outside a game (e.g. while constructing the default object)
+    if (Feats.Num() == 0 || !USGFeatRegistry::Get(this))
+    {
+        return;
+    }
+
+    for (const FSGFeatInstance& Feat : Feats)
+    {
+        if (Feat.FeatType < ESGFeatType::MAX)
+        {
+            for (int32 StackNumber = 1; StackNumber <= Feat.StackCount; ++StackNumber)
+            {
+                ApplyBenefitStack(Feat.FeatType, StackNumber);
+            }
+        }
+    }
+}
+
 bool USGFeatComponent::MeetsPrerequisites(ESGFeatType FeatType) const
 {
     if (!OwnerCharacter.IsValid())
@@ -127,48 +269,198 @@ bool USGFeatComponent::MeetsPrerequisites(ESGFeatType FeatType) const
         return false;
     }
 
-    if (USGFeatData* FeatData = GetFeatData(FeatType))
+    // Prerequisite programs are compiled from the feat data, so nothing is met until it has loaded
+    const USGFeatRegistry* Registry = GetFeatData(FeatType) ? USGFeatRegistry::Get(this) : nullptr;
+    return Registry && Registry->MeetsPrerequisites(FeatType, FSGCharacterSnapshot::Capture(OwnerCharacter.Get()));
+}
+
+uint64 USGFeatComponent::GetEligibleFeatMask() const
+{
+    if (!bEligibilityBuilt)
     {
-        return FeatData->ArePrerequisitesMet(OwnerCharacter.Get());
+        // Not ready until the feat data has loaded; HandleFeatsLoaded builds the mask and reports it then
+        const USGFeatRegistry* Registry = USGFeatRegistry::Get(this);
+        if (!OwnerCharacter.IsValid() || !Registry || !Registry->IsLoaded())
+        {
+            return 0;
+        }
+
+        EligibleFeatMask = Registry->GetEligibleFeatMask(FSGCharacterSnapshot::Capture(OwnerCharacter.Get()));
+        bEligibilityBuilt = true;
     }
-    
-    return false;
+    return EligibleFeatMask;
 }
 
-int32 USGFeatComponent::GetFeatCountByCategory(FName Category) const
+void USGFeatComponent::InvalidateFeatEligibility(const FSGPrerequisiteInputChange& Change)
 {
-    int32 Count = 0;
-    for (const FSGFeatInstance& Feat : Feats)
+    PendingEligibilityChange.Append(Change);
+
+    if (!OwnerCharacter.IsValid() || !OwnerCharacter->IsInAttributeTransaction())
+    {
+        RefreshFeatEligibility();
+    }
+}
+
+void USGFeatComponent::RefreshFeatEligibility()
+{
+    const FSGPrerequisiteInputChange Change = PendingEligibilityChange;
+    PendingEligibilityChange = FSGPrerequisiteInputChange();
+
+    // Nothing has asked for eligibility yet, so there is nothing to keep current or notify about
+    if (!bEligibilityBuilt || Change.IsEmpty())
     {
-        if (Feat.FeatData && Feat.FeatData->Category == Category)
+        return;
+    }
+
+    const USGFeatRegistry* Registry = USGFeatRegistry::Get(this);
+    const uint64 Dependents = Registry ? Registry->GetDependentFeats(Change) : 0;
+    if (Dependents == 0)
+    {
+        return;
+    }
+
+    const FSGCharacterSnapshot Snapshot = FSGCharacterSnapshot::Capture(OwnerCharacter.Get());
+    uint64 NewEligibleMask = EligibleFeatMask & ~Dependents;
+    for (uint64 Remaining = Dependents; Remaining; Remaining &= Remaining - 1)
+    {
+        const ESGFeatType FeatType = static_cast<ESGFeatType>(FMath::CountTrailingZeros64(Remaining));
+        if (Registry->MeetsPrerequisites(FeatType, Snapshot))
         {
-            Count++;
+            NewEligibleMask |= SGFeats::Bit(FeatType);
         }
     }
-    return Count;
+
+    const uint64 Flipped = NewEligibleMask ^ EligibleFeatMask;
+    EligibleFeatMask = NewEligibleMask;
+    if (Flipped == 0)
+    {
+        return;
+    }
+
+    TArray<ESGFeatType> GainedFeats;
+    TArray<ESGFeatType> LostFeats;
+    for (uint64 Remaining = Flipped; Remaining; Remaining &= Remaining - 1)
+    {
+        const int32 Index = FMath::CountTrailingZeros64(Remaining);
+        (NewEligibleMask & (uint64(1) << Index) ? GainedFeats : LostFeats).Add(static_cast<ESGFeatType>(Index));
+    }
+
+    UE_LOG(LogSGFeats, Verbose, TEXT("SGFeatComponent: %s gained %d and lost %d eligible feats"),
+        *GetNameSafe(OwnerCharacter.Get()), GainedFeats.Num(), LostFeats.Num());
+    OnFeatEligibilityChanged.Broadcast(this, GainedFeats, LostFeats);
+}
+
+void USGFeatComponent::GetFeatsByCategory(ESGFeatCategory Category, TArray<FSGFeatInstance>& OutFeats) const
+{
+    OutFeats.Reset(GetFeatCountByCategory(Category));
+    ForEachFeatInCategory(Category, [&OutFeats](const FSGFeatInstance& Feat)
+    {
+        OutFeats.Add(Feat);
+    });
 }
 
-void USGFeatComponent::GetFeatsByCategory(FName Category, TArray<FSGFeatInstance>& OutFeats) const
+void USGFeatComponent::ForEachFeatInCategory(ESGFeatCategory Category, TFunctionRef<void(const FSGFeatInstance&)> Visitor) const
 {
-    OutFeats.Reset();
+    const uint64 CategoryMask = GetCategoryFeatMask(Category);
+    if (CategoryMask == 0)
+    {
+        return;
+    }
+
     for (const FSGFeatInstance& Feat : Feats)
     {
-        if (Feat.FeatData && Feat.FeatData->Category == Category)
+        if (CategoryMask & SGFeats::Bit(Feat.FeatType))
         {
-            OutFeats.Add(Feat);
+            Visitor(Feat);
         }
     }
 }
 
-USGFeatData* USGFeatComponent::GetFeatData(ESGFeatType FeatType) const
+const USGFeatData* USGFeatComponent::GetFeatData(ESGFeatType FeatType) const
 {
-    // TODO: Implement feat data loading from data assets
-    // For now, we'll create a default instance
-    return NewObject<USGFeatData>();
+    const USGFeatRegistry* Registry = USGFeatRegistry::Get(this);
+    if (!Registry || !Registry->IsLoaded())
+    {
+        return nullptr;
+    }
+
+    const USGFeatData* FeatData = Registry->GetFeatData(FeatType);
+    if (!FeatData)
+    {
+        UE_LOG(LogSGFeats, Warning, TEXT("SGFeatComponent: No feat data for feat %d"), static_cast<int32>(FeatType));
+    }
+    return FeatData;
+}
+
+void USGFeatComponent::HandleFeatsLoaded(int32 NumFeats)
+{
+    USGFeatRegistry* Registry = USGFeatRegistry::Get(this);
+    if (!Registry)
+    {
+        return;
+    }
+    Registry->OnFeatsLoaded.RemoveDynamic(this, &USGFeatComponent::HandleFeatsLoaded);
+
+    if (!OwnerCharacter.IsValid())
+    {
+        return;
+    }
+
+    // Feats granted while loading have no data yet
+    for (FSGFeatInstance& Feat : Feats)
+    {
+        if (!Feat.FeatData && Feat.FeatType < ESGFeatType::MAX)
+        {
+            Feat.FeatData = Registry->GetFeatData(Feat.FeatType);
+        }
+    }
+
+    RebuildFeatLookup();
+    ReapplyAllBenefits();
+    OwnerCharacter->InvalidateDerivedStats(ESGDerivedInput::Feats);
+
+    // Every feat read as ineligible while loading, so each eligible one is reported as gained
+    const uint64 NewEligibleMask = GetEligibleFeatMask();
+    if (NewEligibleMask != 0)
+    {
+        TArray<ESGFeatType> GainedFeats;
+        for (uint64 Remaining = NewEligibleMask; Remaining; Remaining &= Remaining - 1)
+        {
+            GainedFeats.Add(static_cast<ESGFeatType>(FMath::CountTrailingZeros64(Remaining)));
+        }
+        OnFeatEligibilityChanged.Broadcast(this, GainedFeats, TArray<ESGFeatType>());
+    }
+}
+
+void USGFeatComponent::RebuildFeatLookup()
+{
+    // Owned feats feed prerequisites, so eligibility is rebuilt on next use
+    bEligibilityBuilt = false;
+    OwnedFeatMask = 0;
+    FMemory::Memzero(FeatStackCounts);
+    FMemory::Memzero(CategoryFeatMasks);
+
+    for (const FSGFeatInstance& Feat : Feats)
+    {
+        if (Feat.FeatType < ESGFeatType::MAX)
+        {
+            OwnedFeatMask |= SGFeats::Bit(Feat.FeatType);
+            FeatStackCounts[static_cast<uint8>(Feat.FeatType)] = Feat.StackCount;
+            if (Feat.FeatData && Feat.FeatData->FeatCategory < ESGFeatCategory::MAX)
+            {
+                CategoryFeatMasks[static_cast<uint8>(Feat.FeatData->FeatCategory)] |= SGFeats::Bit(Feat.FeatType);
+            }
+        }
+    }
 }
 
 FSGFeatInstance* USGFeatComponent::FindFeatInstance(ESGFeatType FeatType)
 {
+    if (!HasFeat(FeatType))
+    {
+        return nullptr;
+    }
+
     for (FSGFeatInstance& Feat : Feats)
     {
         if (Feat.FeatType == FeatType)
@@ -181,6 +473,11 @@ FSGFeatInstance* USGFeatComponent::FindFeatInstance(ESGFeatType FeatType)
 
 const FSGFeatInstance* USGFeatComponent::FindFeatInstance(ESGFeatType FeatType) const
 {
+    if (!HasFeat(FeatType))
+    {
+        return nullptr;
+    }
+
     for (const FSGFeatInstance& Feat : Feats)
     {
         if (Feat.FeatType == FeatType)
@@ -6,10 +6,15 @@
 #include "Components/ActorComponent.h"
 #include "SGFeatTypes.h"
 #include "SGFeatData.h"
+#include "SGFeatPrerequisiteProgram.h"
 #include "SGFeatComponent.generated.h"
 
 class USGFeatData;
 class ASGCharacterBase;
+class USGFeatComponent;
+
+// Delegate for when feats become available or unavailable to a character
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnFeatEligibilityChanged, USGFeatComponent*, FeatComponent, const TArray<ESGFeatType>&, GainedFeats, const TArray<ESGFeatType>&, LostFeats);
 
 /** Structure to track a feat and its current stack count */
 USTRUCT(BlueprintType)
@@ -21,9 +26,9 @@ struct FSGFeatInstance
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Feat")
     ESGFeatType FeatType;
     
-    // The data for this feat
+    // The data for this feat, owned by USGFeatRegistry
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Feat")
-    TObjectPtr<USGFeatData> FeatData;
+    TObjectPtr<const USGFeatData> FeatData;
     
     // Current stack count (for feats that can be taken multiple times)
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Feat")
@@ -36,7 +41,7 @@ struct FSGFeatInstance
     {
     }
     
-    FSGFeatInstance(ESGFeatType InFeatType, USGFeatData* InFeatData, int32 InStackCount = 1)
+    FSGFeatInstance(ESGFeatType InFeatType, const USGFeatData* InFeatData, int32 InStackCount = 1)
         : FeatType(InFeatType)
         , FeatData(InFeatData)
         , StackCount(InStackCount)
@@ -47,6 +52,18 @@ struct FSGFeatInstance
     bool IsValid() const { return FeatType != ESGFeatType::MAX && FeatData != nullptr; }
 };
 
+/**
+ * Undo journal of the modifiers one feat wrote to its owner's ledger.
+ * Every stack appends one handle per compiled effect, so undoing a stack pops the tail.
+ */
+struct FSGFeatBenefitJournal
+{
+    TArray<FSGModifierHandle, TInlineAllocator<4>> Handles;
+
+    /** Handles written by each stack */
+    int32 HandlesPerStack = 0;
+};
+
 /**
  * Component that manages a character's feats
  */
@@ -61,6 +78,7 @@ public:
 
     //~ Begin UActorComponent Interface
     virtual void BeginPlay() override;
+    virtual void PostLoad() override;
     //~ End UActorComponent Interface
 
     /**
@@ -74,7 +92,22 @@ public:
      * @return True if the character has the feat, false otherwise
      */
     UFUNCTION(BlueprintCallable, Category = "Feats")
-    bool HasFeat(ESGFeatType FeatType) const;
+    bool HasFeat(ESGFeatType FeatType) const { return (OwnedFeatMask & SGFeats::Bit(FeatType)) != 0; }
+    
+    /**
+     * Check if the character has every feat in a mask
+     * @param FeatMask Feats to check, see SGFeats::MakeMask
+     */
+    bool HasAllFeats(uint64 FeatMask) const { return (OwnedFeatMask & FeatMask) == FeatMask; }
+    
+    /**
+     * Check if the character has at least one feat in a mask
+     * @param FeatMask Feats to check, see SGFeats::MakeMask
+     */
+    bool HasAnyFeats(uint64 FeatMask) const { return (OwnedFeatMask & FeatMask) != 0; }
+    
+    /** Get a bit per owned feat, see SGFeats::Bit */
+    uint64 GetOwnedFeatMask() const { return OwnedFeatMask; }
     
     /**
      * Get the stack count for a feat
@@ -82,10 +115,11 @@ public:
      * @return The current stack count (0 if the character doesn't have the feat)
      */
     UFUNCTION(BlueprintCallable, Category = "Feats")
-    int32 GetFeatStackCount(ESGFeatType FeatType) const;
+    int32 GetFeatStackCount(ESGFeatType FeatType) const { return FeatType < ESGFeatType::MAX ? FeatStackCounts[static_cast<uint8>(FeatType)] : 0; }
     
     /**
-     * Add a feat to the character
+     * Add a feat to the character.
+     * While the feat data is still loading, only unchecked grants succeed; their benefits apply once it loads.
      * @param FeatType The type of feat to add
      * @param bCheckPrerequisites Whether to check prerequisites before adding
      * @return True if the feat was added successfully, false otherwise
@@ -101,6 +135,14 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Feats")
     bool RemoveFeat(ESGFeatType FeatType);
     
+    /**
+     * Remove one stack of a feat, removing the feat when its last stack goes
+     * @param FeatType The type of feat to reduce
+     * @return True if a stack was removed, false if the character didn't have the feat
+     */
+    UFUNCTION(BlueprintCallable, Category = "Feats")
+    bool RemoveFeatStack(ESGFeatType FeatType);
+    
     /**
      * Get all feats the character has
      * @return Array of feat instances
@@ -111,26 +153,76 @@ public:
     /**
      * Check if the character meets all prerequisites for a feat
      * @param FeatType The type of feat to check
-     * @return True if all prerequisites are met, false otherwise
+     * @return True if all prerequisites are met, false otherwise or while the feat data is still loading
      */
     UFUNCTION(BlueprintCallable, Category = "Feats")
     bool MeetsPrerequisites(ESGFeatType FeatType) const;
     
+    /**
+     * Get every feat whose prerequisites the character currently meets, owned or not.
+     * Kept up to date incrementally; only the first call evaluates every feat.
+     * Reads as no feats while the feat data is still loading; OnFeatEligibilityChanged reports the eligible
+     * feats once it has loaded.
+     * @return Bit per eligible feat, see SGFeats::Bit
+     */
+    uint64 GetEligibleFeatMask() const;
+    
+    /**
+     * Check if the character currently meets the prerequisites for a feat, using the cached eligibility
+     */
+    UFUNCTION(BlueprintPure, Category = "Feats")
+    bool IsEligibleForFeat(ESGFeatType FeatType) const { return (GetEligibleFeatMask() & SGFeats::Bit(FeatType)) != 0; }
+    
+    /**
+     * Record that prerequisite inputs changed. Only the feats that read those inputs are re-evaluated,
+     * immediately or once when the owner's attribute transaction commits.
+     * @param Change The inputs that changed
+     */
+    void InvalidateFeatEligibility(const FSGPrerequisiteInputChange& Change);
+    
+    /**
+     * Re-evaluate the feats affected by pending input changes and broadcast any that flipped
+     */
+    void RefreshFeatEligibility();
+    
+    /**
+     * Called when feats become available or unavailable because the character's prerequisites changed
+     */
+    UPROPERTY(BlueprintAssignable, Category = "Feats")
+    FOnFeatEligibilityChanged OnFeatEligibilityChanged;
+    
     /**
      * Get the number of feats the character has of a specific category
      * @param Category The category to count feats for
      * @return The number of feats in the specified category
      */
     UFUNCTION(BlueprintCallable, Category = "Feats")
-    int32 GetFeatCountByCategory(FName Category) const;
+    int32 GetFeatCountByCategory(ESGFeatCategory Category) const { return FMath::CountBits(GetCategoryFeatMask(Category)); }
     
     /**
-     * Get all feats of a specific category
+     * Get all feats of a specific category.
+     * Copies the instances for Blueprints; C++ should use ForEachFeatInCategory.
      * @param Category The category to get feats for
      * @param OutFeats Output array of feats in the category
      */
     UFUNCTION(BlueprintCallable, Category = "Feats")
-    void GetFeatsByCategory(FName Category, TArray<FSGFeatInstance>& OutFeats) const;
+    void GetFeatsByCategory(ESGFeatCategory Category, TArray<FSGFeatInstance>& OutFeats) const;
+    
+    /**
+     * Get the owned feats of a category
+     * @return Bit per owned feat in the category, see SGFeats::Bit
+     */
+    uint64 GetCategoryFeatMask(ESGFeatCategory Category) const
+    {
+        return Category < ESGFeatCategory::MAX ? CategoryFeatMasks[static_cast<uint8>(Category)] : 0;
+    }
+    
+    /**
+     * Visit every owned feat of a category without copying or allocating
+     * @param Category The category to visit
+     * @param Visitor Called once per feat instance in the category
+     */
+    void ForEachFeatInCategory(ESGFeatCategory Category, TFunctionRef<void(const FSGFeatInstance&)> Visitor) const;
 
 protected:
     /** The character that owns this component */
@@ -142,11 +234,44 @@ protected:
     TArray<FSGFeatInstance> Feats;
     
     /**
-     * Get the feat data for a feat type
+     * Rebuild the owned-feat mask and stack counts from the Feats array
+     */
+    void RebuildFeatLookup();
+    
+    /**
+     * Write one stack of a feat's compiled benefits to the owner's modifier ledger and journal the handles
+     * @param FeatType The feat
+     * @param StackNumber The stack being applied, starting at 1
+     */
+    void ApplyBenefitStack(ESGFeatType FeatType, int32 StackNumber);
+    
+    /**
+     * Undo the most recently applied stack of a feat's benefits
+     */
+    void UndoBenefitStack(ESGFeatType FeatType);
+    
+    /**
+     * Undo every stack of a feat's benefits
+     */
+    void UndoAllBenefits(ESGFeatType FeatType);
+    
+    /**
+     * Re-apply the benefits of every owned feat; the modifier ledger is runtime state and starts empty
+     */
+    void ReapplyAllBenefits();
+    
+    /**
+     * Get the feat data for a feat type from the feat registry
      * @param FeatType The type of feat to get data for
-     * @return The feat data, or nullptr if not found
+     * @return The feat data, or nullptr if not found or the registry has not finished loading
+     */
+    const USGFeatData* GetFeatData(ESGFeatType FeatType) const;
+
+    /**
+     * Resolve feats granted while loading, apply every owned feat's benefits and report eligibility
      */
-    USGFeatData* GetFeatData(ESGFeatType FeatType) const;
+    UFUNCTION()
+    void HandleFeatsLoaded(int32 NumFeats);
     
     /**
      * Find an existing feat instance
@@ -161,4 +286,26 @@ protected:
      * @return Pointer to the feat instance, or nullptr if not found
      */
     const FSGFeatInstance* FindFeatInstance(ESGFeatType FeatType) const;
+
+private:
+    /** Bit per owned feat, kept in sync with Feats */
+    uint64 OwnedFeatMask = 0;
+    
+    /** Stack count per feat indexed by ESGFeatType, kept in sync with Feats */
+    int32 FeatStackCounts[SGFeatCount] = {};
+    
+    /** Modifiers written by each feat indexed by ESGFeatType */
+    FSGFeatBenefitJournal BenefitJournals[SGFeatCount];
+    
+    /** Owned feats per category indexed by ESGFeatCategory, kept in sync with Feats */
+    uint64 CategoryFeatMasks[SGFeatCategoryCount] = {};
+    
+    /** Bit per feat whose prerequisites are met, valid once bEligibilityBuilt is set */
+    mutable uint64 EligibleFeatMask = 0;
+    
+    /** Set once EligibleFeatMask has been built from every feat */
+    mutable bool bEligibilityBuilt = false;
+    
+    /** Inputs changed since the last refresh */
+    FSGPrerequisiteInputChange PendingEligibilityChange;
 };
@@ -3,6 +3,10 @@
 #include "SGSkillComponent.h"
 #include "SGCharacterBase.h"
 #include "SGSkillType.h"
+#include "SGRulesTables.h"
+#include "SGLog.h"
+#include "SGTrace.h"
+#include "SGDiceSubsystem.h"
 #include "Math/UnrealMathUtility.h"
 
 USGSkillComponent::USGSkillComponent()
@@ -36,63 +40,105 @@ void USGSkillComponent::Initialize(ASGCharacterBase* InOwnerCharacter)
 {
     if (!InOwnerCharacter)
     {
-        UE_LOG(LogTemp, Warning, TEXT("SGSkillComponent: Invalid owner character"));
+        UE_LOG(LogSGSkills, Warning, TEXT("SGSkillComponent: Invalid owner character"));
         return;
     }
 
     OwnerCharacter = InOwnerCharacter;
+    InvalidateSkills(SGSkills::AllSkillsMask);
     
-    // Initialize skills if empty
-    if (Skills.Skills.Num() == 0)
-    {
-        // Add all skills with default values
-        for (uint8 i = 0; i < static_cast<uint8>(ESGSkillType::MAX); ++i)
-        {
-            ESGSkillType SkillType = static_cast<ESGSkillType>(i);
-            Skills.GetOrAddSkill(SkillType, false, false);
-        }
-    }
-    
-    UE_LOG(LogTemp, Log, TEXT("SGSkillComponent: Initialized for %s"), *GetNameSafe(OwnerCharacter.Get()));
+    UE_LOG(LogSGSkills, Verbose, TEXT("SGSkillComponent: Initialized for %s"), *GetNameSafe(OwnerCharacter.Get()));
 }
 
 int32 USGSkillComponent::AddSkillRanks(ESGSkillType SkillType, int32 RanksToAdd)
 {
     if (!OwnerCharacter.IsValid())
     {
-        UE_LOG(LogTemp, Warning, TEXT("SGSkillComponent: No owner character"));
+        UE_LOG(LogSGSkills, Warning, TEXT("SGSkillComponent: No owner character"));
+        return 0;
+    }
+
+    if (SkillType >= ESGSkillType::MAX)
+    {
         return 0;
     }
 
-    // Get or add the skill
-    FSGSkillData& SkillData = Skills.GetOrAddSkill(SkillType);
-    
     // Update ranks, ensuring they don't go below 0
-    const int32 NewRanks = FMath::Max(0, SkillData.Ranks + RanksToAdd);
-    const int32 ActualRanksAdded = NewRanks - SkillData.Ranks;
-    SkillData.Ranks = NewRanks;
+    const int32 OldRanks = Skills.GetRanks(SkillType);
+    Skills.SetRanks(SkillType, OldRanks + RanksToAdd);
+    const int32 NewRanks = Skills.GetRanks(SkillType);
+    InvalidateSkills(SGSkills::Bit(SkillType));
+    
+    // Skill ranks are also feat prerequisites
+    USGFeatComponent* FeatComponent = OwnerCharacter->GetFeatComponent();
+    if (FeatComponent && NewRanks != OldRanks)
+    {
+        FSGPrerequisiteInputChange Change;
+        Change.Skills = SGSkills::Bit(SkillType);
+        FeatComponent->InvalidateFeatEligibility(Change);
+    }
     
-    UE_LOG(LogTemp, Log, TEXT("SGSkillComponent: Added %d ranks to %s for %s (total: %d)"),
-        RanksToAdd, *GetSkillDisplayName(SkillType), *GetNameSafe(OwnerCharacter.Get()), SkillData.Ranks);
+    SG_TRACE(SkillRanksChanged, OwnerCharacter.Get(), static_cast<int32>(SkillType), NewRanks - OldRanks, NewRanks);
+    UE_LOG(LogSGSkills, Verbose, TEXT("SGSkillComponent: Added %d ranks to %s for %s (total: %d)"),
+        RanksToAdd, *GetSkillDisplayName(SkillType), *GetNameSafe(OwnerCharacter.Get()), NewRanks);
     
-    return SkillData.Ranks;
+    return NewRanks;
 }
 
 void USGSkillComponent::SetClassSkill(ESGSkillType SkillType, bool bIsClassSkill)
 {
-    if (!OwnerCharacter.IsValid())
+    if (!OwnerCharacter.IsValid() || SkillType >= ESGSkillType::MAX)
     {
         return;
     }
 
-    FSGSkillData& SkillData = Skills.GetOrAddSkill(SkillType);
-    SkillData.ClassSkill = bIsClassSkill;
+    Skills.SetClassSkill(SkillType, bIsClassSkill);
+    InvalidateSkills(SGSkills::Bit(SkillType));
     
-    UE_LOG(LogTemp, Log, TEXT("SGSkillComponent: Set %s as %s class skill for %s"),
+    SG_TRACE(ClassSkillChanged, OwnerCharacter.Get(), static_cast<int32>(SkillType), bIsClassSkill ? 1 : 0);
+    UE_LOG(LogSGSkills, Verbose, TEXT("SGSkillComponent: Set %s as %s class skill for %s"),
         *GetSkillDisplayName(SkillType), bIsClassSkill ? TEXT("a") : TEXT("not a"), *GetNameSafe(OwnerCharacter.Get()));
 }
 
 int32 USGSkillComponent::GetSkillBonus(ESGSkillType SkillType) const
+{
+    if (SkillType >= ESGSkillType::MAX)
+    {
+        return 0;
+    }
+
+    if (DirtySkills & SGSkills::Bit(SkillType))
+    {
+        RefreshSkillBonuses();
+    }
+    return SkillBonuses[static_cast<uint8>(SkillType)];
+}
+
+void USGSkillComponent::InvalidateSkills(uint64 SkillMask)
+{
+    DirtySkills |= SkillMask & SGSkills::AllSkillsMask;
+
+    // Keep the table current for GetCachedSkillBonus; an open transaction rebuilds once at commit
+    if (!OwnerCharacter.IsValid() || !OwnerCharacter->IsInAttributeTransaction())
+    {
+        RefreshSkillBonuses();
+    }
+}
+
+void USGSkillComponent::RefreshSkillBonuses() const
+{
+    uint64 Remaining = DirtySkills;
+    DirtySkills = 0;
+
+    while (Remaining)
+    {
+        const int32 Index = FMath::CountTrailingZeros64(Remaining);
+        Remaining &= Remaining - 1;
+        SkillBonuses[Index] = ComputeSkillBonus(static_cast<ESGSkillType>(Index));
+    }
+}
+
+int32 USGSkillComponent::ComputeSkillBonus(ESGSkillType SkillType) const
 {
     if (!OwnerCharacter.IsValid())
     {
@@ -102,12 +148,7 @@ int32 USGSkillComponent::GetSkillBonus(ESGSkillType SkillType) const
     const int32 AbilityMod = GetAbilityModifierForSkill(SkillType);
     const int32 MiscMod = GetMiscModifiersForSkill(SkillType);
     
-    if (const FSGSkillData* SkillData = Skills.GetSkill(SkillType))
-    {
-        return SkillData->CalculateTotalBonus(AbilityMod, MiscMod);
-    }
-    
-    return 0;
+    return Skills.GetSkillBonus(SkillType, AbilityMod, MiscMod);
 }
 
 void USGSkillComponent::PerformSkillCheck(ESGSkillType SkillType, int32 DifficultyClass, int32 Modifier, bool& bOutSuccess, int32& OutRollResult, int32& OutDC) const
@@ -120,8 +161,15 @@ void USGSkillComponent::PerformSkillCheck(ESGSkillType SkillType, int32 Difficul
         return;
     }
 
-    // Roll a d20
-    OutRollResult = FMath::RandRange(1, 20);
+    // Roll a d20 from the owner's skill check stream so the roll can be replayed
+    if (USGDiceSubsystem* Dice = USGDiceSubsystem::Get(this))
+    {
+        OutRollResult = Dice->RollD20(OwnerCharacter.Get(), ESGDicePurpose::SkillCheck);
+    }
+    else
+    {
+        OutRollResult = FMath::RandRange(1, 20);
+    }
     OutDC = DifficultyClass;
     
     // Get the skill bonus
@@ -130,44 +178,136 @@ void USGSkillComponent::PerformSkillCheck(ESGSkillType SkillType, int32 Difficul
     // Check if the roll plus bonus meets or exceeds the DC
     bOutSuccess = (OutRollResult + SkillBonus) >= OutDC;
     
-    UE_LOG(LogTemp, Log, TEXT("SGSkillComponent: %s rolled %d + %d (bonus) vs DC %d - %s"),
+    SG_TRACE(SkillCheck, OwnerCharacter.Get(), static_cast<int32>(SkillType) | (OutDC << 8), OutRollResult, SkillBonus);
+    UE_LOG(LogSGSkills, Verbose, TEXT("SGSkillComponent: %s rolled %d + %d (bonus) vs DC %d - %s"),
         *GetSkillDisplayName(SkillType), OutRollResult, SkillBonus, OutDC,
         bOutSuccess ? TEXT("Success") : TEXT("Failure"));
 }
 
-int32 USGSkillComponent::GetSkillRanks(ESGSkillType SkillType) const
+FSGCheckOdds USGSkillComponent::GetSkillCheckOdds(ESGSkillType SkillType, int32 DifficultyClass, ESGCheckMode Mode) const
 {
-    if (const FSGSkillData* SkillData = Skills.GetSkill(SkillType))
+    if (SkillType >= ESGSkillType::MAX || !Skills.CanUseSkill(SkillType))
     {
-        return SkillData->Ranks;
+        return FSGCheckOdds();
     }
-    return 0;
+    return SGCheckOdds::GetOdds(ESGCheckKind::SkillCheck, GetSkillBonus(SkillType), DifficultyClass, Mode);
 }
 
-bool USGSkillComponent::IsClassSkill(ESGSkillType SkillType) const
+void USGSkillComponent::PerformGroupSkillCheck(TConstArrayView<const ASGCharacterBase*> Characters, ESGSkillType SkillType, int32 DifficultyClass, FSGDiceStream& DiceStream, FSGGroupSkillCheckResult& OutResult)
 {
-    if (const FSGSkillData* SkillData = Skills.GetSkill(SkillType))
+    TArray<int32, TInlineAllocator<32>> DifficultyClasses;
+    DifficultyClasses.Init(DifficultyClass, Characters.Num());
+    PerformGroupSkillCheck(Characters, SkillType, DifficultyClasses, DiceStream, OutResult);
+}
+
+void USGSkillComponent::PerformGroupSkillCheck(TConstArrayView<const ASGCharacterBase*> Characters, ESGSkillType SkillType, TConstArrayView<int32> DifficultyClasses, FSGDiceStream& DiceStream, FSGGroupSkillCheckResult& OutResult)
+{
+    check(DifficultyClasses.Num() == Characters.Num());
+
+    const int32 Count = Characters.Num();
+    OutResult.Succeeded.Init(false, Count);
+
+    // An invalid skill fails everyone without rolling, so the entries must not be left uninitialized
+    if (SkillType >= ESGSkillType::MAX || Count == 0)
+    {
+        OutResult.NaturalRolls.SetNumZeroed(Count, EAllowShrinking::No);
+        OutResult.Margins.SetNumZeroed(Count, EAllowShrinking::No);
+        return;
+    }
+
+    // Every entry is written below
+    OutResult.NaturalRolls.SetNumUninitialized(Count, EAllowShrinking::No);
+    OutResult.Margins.SetNumUninitialized(Count, EAllowShrinking::No);
+
+    // Gather bonuses into a packed array; characters who cannot attempt the check get no success bit
+    TArray<int32, TInlineAllocator<32>> Bonuses;
+    Bonuses.SetNumUninitialized(Count);
+    TBitArray<TInlineAllocator<1>> CanAttempt(false, Count);
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        const ASGCharacterBase* Character = Characters[Index];
+        const USGSkillComponent* SkillComponent = Character ? Character->GetSkillComponent() : nullptr;
+        if (SkillComponent && SkillComponent->Skills.CanUseSkill(SkillType))
+        {
+            Bonuses[Index] = SkillComponent->GetSkillBonus(SkillType);
+            CanAttempt[Index] = true;
+        }
+        else
+        {
+            Bonuses[Index] = 0;
+        }
+    }
+
+    DiceStream.RollD20s(OutResult.NaturalRolls);
+
+    const int32* RESTRICT Rolls = OutResult.NaturalRolls.GetData();
+    const int32* RESTRICT BonusData = Bonuses.GetData();
+    const int32* RESTRICT DCs = DifficultyClasses.GetData();
+    int32* RESTRICT Margins = OutResult.Margins.GetData();
+    for (int32 Index = 0; Index < Count; ++Index)
     {
-        return SkillData->ClassSkill;
+        Margins[Index] = Rolls[Index] + BonusData[Index] - DCs[Index];
     }
-    return false;
+
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        OutResult.Succeeded[Index] = CanAttempt[Index] && Margins[Index] >= 0;
+    }
+
+    UE_LOG(LogSGSkills, Verbose, TEXT("SGSkillComponent: Group %s check, %d of %d succeeded"),
+        *GetSkillDisplayName(SkillType), OutResult.CountSucceeded(), Count);
+}
+
+int32 USGSkillComponent::GetSkillRanks(ESGSkillType SkillType) const
+{
+    return SkillType < ESGSkillType::MAX ? Skills.GetRanks(SkillType) : 0;
+}
+
+bool USGSkillComponent::IsClassSkill(ESGSkillType SkillType) const
+{
+    return SkillType < ESGSkillType::MAX && Skills.IsClassSkill(SkillType);
 }
 
 bool USGSkillComponent::CanUseSkill(ESGSkillType SkillType) const
 {
-    if (const FSGSkillData* SkillData = Skills.GetSkill(SkillType))
+    return SkillType < ESGSkillType::MAX && Skills.CanUseSkill(SkillType);
+}
+
+FSGSkillData USGSkillComponent::GetSkillData(ESGSkillType SkillType) const
+{
+    return SkillType < ESGSkillType::MAX ? Skills.GetSkill(SkillType) : FSGSkillData();
+}
+
+TMap<ESGSkillType, FSGSkillData> USGSkillComponent::GetAllSkills() const
+{
+    TMap<ESGSkillType, FSGSkillData> Result;
+    Result.Reserve(SGSkillCount);
+    for (int32 Index = 0; Index < SGSkillCount; ++Index)
+    {
+        const ESGSkillType SkillType = static_cast<ESGSkillType>(Index);
+        Result.Add(SkillType, Skills.GetSkill(SkillType));
+    }
+    return Result;
+}
+
+void USGSkillComponent::SetArmorCheckPenalty(int32 NewPenalty)
+{
+    const int32 ClampedPenalty = FMath::Min(0, NewPenalty);
+    if (Skills.ArmorCheckPenalty == ClampedPenalty)
     {
-        return SkillData->CanUseSkill();
+        return;
     }
-    return false;
+
+    Skills.ArmorCheckPenalty = ClampedPenalty;
+    InvalidateSkills(SGSkills::ArmorCheckPenaltyMask);
 }
 
 ESGAttributeType USGSkillComponent::GetKeyAbilityForSkill(ESGSkillType SkillType)
 {
-    return GetSkillKeyAbility(SkillType);
+    return SGRules::GetSkillKeyAbility(SkillType);
 }
 
-FString USGSkillComponent::GetSkillDisplayName(ESGSkillType SkillType)
+const FString& USGSkillComponent::GetSkillDisplayName(ESGSkillType SkillType)
 {
     return GetSkillName(SkillType);
 }
@@ -185,6 +325,6 @@ int32 USGSkillComponent::GetAbilityModifierForSkill(ESGSkillType SkillType) cons
 
 int32 USGSkillComponent::GetMiscModifiersForSkill(ESGSkillType SkillType) const
 {
-    // TODO: Implement this to handle various skill bonuses from feats, items, etc.
-    return 0;
+    // Feats, items and spells write their skill bonuses into the owner's modifier ledger
+    return OwnerCharacter.IsValid() ? OwnerCharacter->GetModifierTotal(ESGModifierTarget::Skill, SkillType) : 0;
 }
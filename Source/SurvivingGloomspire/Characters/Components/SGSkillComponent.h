@@ -5,9 +5,31 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "SGSkillData.h"
+#include "SGCheckOdds.h"
+#include "Containers/BitArray.h"
 #include "SGSkillComponent.generated.h"
 
 class ASGCharacterBase;
+struct FSGDiceStream;
+
+/**
+ * Outcome of a skill check made by a group of characters, one entry per character in the order given
+ */
+struct SURVIVINGGLOOMSPIRE_API FSGGroupSkillCheckResult
+{
+    /** Bit per character that met or beat its DC */
+    TBitArray<> Succeeded;
+
+    /** Natural d20 roll of each character */
+    TArray<int32> NaturalRolls;
+
+    /** Roll plus bonus minus DC of each character; negative on failure */
+    TArray<int32> Margins;
+
+    int32 Num() const { return NaturalRolls.Num(); }
+
+    int32 CountSucceeded() const { return Succeeded.CountSetBits(); }
+};
 
 /**
  * Component that manages a character's skills
@@ -47,11 +69,39 @@ public:
     void SetClassSkill(ESGSkillType SkillType, bool bIsClassSkill);
 
     /**
-     * Get the total bonus for a skill, including all modifiers
+     * Get the total bonus for a skill, including all modifiers.
+     * Rebuilds the cached total first if one of its inputs changed.
      */
     UFUNCTION(BlueprintCallable, Category = "Skills")
     int32 GetSkillBonus(ESGSkillType SkillType) const;
 
+    /**
+     * Get a skill total straight from the cached table.
+     * The table is rebuilt as soon as an input changes, so it is current except while the owner
+     * has an attribute transaction open.
+     */
+    FORCEINLINE int32 GetCachedSkillBonus(ESGSkillType SkillType) const
+    {
+        checkSlow(SkillType < ESGSkillType::MAX);
+        return SkillBonuses[static_cast<uint8>(SkillType)];
+    }
+
+    /**
+     * Get the cached total of every skill, indexed by ESGSkillType
+     */
+    TConstArrayView<int32> GetSkillBonusTable() const { return MakeArrayView(SkillBonuses); }
+
+    /**
+     * Mark skill totals as needing a rebuild
+     * @param SkillMask Bit per ESGSkillType whose inputs changed, see SGSkills::Bit
+     */
+    void InvalidateSkills(uint64 SkillMask);
+
+    /**
+     * Rebuild every skill total marked dirty
+     */
+    void RefreshSkillBonuses() const;
+
     /**
      * Perform a skill check
      * @param SkillType The skill to check
@@ -62,6 +112,34 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Skills")
     void PerformSkillCheck(ESGSkillType SkillType, int32 DifficultyClass, int32 Modifier, bool& bOutSuccess, int32& OutRollResult, int32& OutDC) const;
 
+    /**
+     * Get the exact odds of a skill check without rolling it
+     * @param SkillType The skill to check
+     * @param DifficultyClass The DC to meet
+     * @param Mode Roll, take 10 or take 20
+     */
+    UFUNCTION(BlueprintPure, Category = "Skills")
+    FSGCheckOdds GetSkillCheckOdds(ESGSkillType SkillType, int32 DifficultyClass, ESGCheckMode Mode = ESGCheckMode::Roll) const;
+
+    /**
+     * Perform the same skill check for a group of characters, e.g. passive Perception or group Stealth.
+     * Bonuses are read from each character's cached skill table and every d20 is drawn in one bulk call.
+     * Characters without a skill component, or who cannot use a trained-only skill, always fail.
+     * An invalid skill fails everyone with zeroed rolls and margins.
+     * @param Characters The characters making the check
+     * @param SkillType The skill to check
+     * @param DifficultyClass The DC every character must meet
+     * @param DiceStream Stream the d20s are drawn from, e.g. from USGDiceSubsystem
+     * @param OutResult Filled with one entry per character
+     */
+    static void PerformGroupSkillCheck(TConstArrayView<const ASGCharacterBase*> Characters, ESGSkillType SkillType, int32 DifficultyClass, FSGDiceStream& DiceStream, FSGGroupSkillCheckResult& OutResult);
+
+    /**
+     * Perform the same skill check for a group of characters against a separate DC for each
+     * @param DifficultyClasses DC per character; must have the same length as Characters
+     */
+    static void PerformGroupSkillCheck(TConstArrayView<const ASGCharacterBase*> Characters, ESGSkillType SkillType, TConstArrayView<int32> DifficultyClasses, FSGDiceStream& DiceStream, FSGGroupSkillCheckResult& OutResult);
+
     /**
      * Get the number of ranks in a skill
      */
@@ -81,9 +159,34 @@ public:
     bool CanUseSkill(ESGSkillType SkillType) const;
 
     /**
-     * Get all skills as a map
+     * Get a single skill's data
+     */
+    UFUNCTION(BlueprintCallable, Category = "Skills")
+    FSGSkillData GetSkillData(ESGSkillType SkillType) const;
+
+    /**
+     * Get all skills as a map (builds a new map; prefer GetSkills in C++)
+     */
+    UFUNCTION(BlueprintCallable, Category = "Skills")
+    TMap<ESGSkillType, FSGSkillData> GetAllSkills() const;
+
+    /**
+     * Get the packed skill storage
      */
-    const TMap<ESGSkillType, FSGSkillData>& GetAllSkills() const { return Skills.Skills; }
+    const FSGSkillContainer& GetSkills() const { return Skills; }
+
+    /**
+     * Set the armor check penalty from worn armor and shields
+     * @param NewPenalty The penalty (zero or negative), applied to every STR- and DEX-based skill
+     */
+    UFUNCTION(BlueprintCallable, Category = "Skills")
+    void SetArmorCheckPenalty(int32 NewPenalty);
+
+    /**
+     * Get the armor check penalty from worn armor and shields
+     */
+    UFUNCTION(BlueprintCallable, Category = "Skills")
+    int32 GetArmorCheckPenalty() const { return Skills.ArmorCheckPenalty; }
 
     /**
      * Get the key ability score for a skill
@@ -95,7 +198,7 @@ public:
      * Get the display name of a skill
      */
     UFUNCTION(BlueprintCallable, Category = "Skills")
-    static FString GetSkillDisplayName(ESGSkillType SkillType);
+    static const FString& GetSkillDisplayName(ESGSkillType SkillType);
 
 protected:
     /** The character that owns this component */
@@ -115,4 +218,16 @@ protected:
      * Get any miscellaneous modifiers that apply to a skill
      */
     int32 GetMiscModifiersForSkill(ESGSkillType SkillType) const;
+
+    /**
+     * Compute a skill total from its inputs
+     */
+    int32 ComputeSkillBonus(ESGSkillType SkillType) const;
+
+private:
+    /** Cached total of each skill, indexed by ESGSkillType */
+    mutable int32 SkillBonuses[SGSkillCount] = {};
+
+    /** Bit per ESGSkillType whose cached total is out of date */
+    mutable uint64 DirtySkills = SGSkills::AllSkillsMask;
 };
@@ -0,0 +1,63 @@
+// Copyright 2025 Surviving Gloomspire Team. All Rights Reserved.
+
+#include "SGFeatBenefit.h"
+#include "SGCompileDiagnostics.h"
+#include "SGEnumNames.h"
+
+#define LOCTEXT_NAMESPACE "SGFeatBenefits"
+
+namespace SGFeatBenefits
+{
+    bool Compile(TConstArrayView<FSGFeatBenefit> Benefits, FSGFeatEffectList& OutEffects, TArray<FText>* OutErrors)
+    {
+        OutEffects.Reset();
+        FSGCompileDiagnostics Diagnostics(OutErrors);
+
+        for (int32 Index = 0; Index < Benefits.Num(); ++Index)
+        {
+            const FSGFeatBenefit& Benefit = Benefits[Index];
+
+            FSGFeatEffect Effect;
+            if (!SGEnumNames::Resolve(Benefit.BenefitType.ToString(), static_cast<int32>(ESGModifierTarget::MAX), Effect.Target))
+            {
+                Diagnostics.AddError(FText::Format(LOCTEXT("UnknownTarget", "Benefit {0}: unknown benefit type '{1}'"), Index, FText::FromName(Benefit.BenefitType)));
+                continue;
+            }
+
+            bool bHasSkill = false;
+            bool bWordsValid = true;
+            TArray<FString> Words;
+            Benefit.Data.ParseIntoArrayWS(Words);
+            for (const FString& Word : Words)
+            {
+                if (SGEnumNames::Resolve(Word, static_cast<int32>(ESGBonusType::MAX), Effect.BonusType))
+                {
+                    continue;
+                }
+                if (Effect.Target == ESGModifierTarget::Skill && SGEnumNames::Resolve(Word, SGSkillCount, Effect.SkillType))
+                {
+                    bHasSkill = true;
+                    continue;
+                }
+                Diagnostics.AddError(FText::Format(LOCTEXT("UnknownWord", "Benefit {0}: '{1}' is not a bonus type or skill"), Index, FText::FromString(Word)));
+                bWordsValid = false;
+            }
+
+            if (Effect.Target == ESGModifierTarget::Skill && !bHasSkill)
+            {
+                Diagnostics.AddError(FText::Format(LOCTEXT("MissingSkill", "Benefit {0}: skill benefits must name a skill in Data"), Index));
+                bWordsValid = false;
+            }
+
+            if (bWordsValid)
+            {
+                Effect.Value = static_cast<int16>(FMath::Clamp(FMath::RoundToInt(Benefit.Value), static_cast<int32>(MIN_int16), static_cast<int32>(MAX_int16)));
+                OutEffects.Add(Effect);
+            }
+        }
+
+        return Diagnostics.AllCompiled();
+    }
+}
+
+#undef LOCTEXT_NAMESPACE
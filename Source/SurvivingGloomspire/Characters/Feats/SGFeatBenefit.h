@@ -3,10 +3,15 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "SGModifierLedger.h"
 #include "SGFeatBenefit.generated.h"
 
 /**
- * Structure defining the benefits provided by a feat
+ * Structure defining the benefits provided by a feat.
+ *
+ * BenefitType names the modified stat as an ESGModifierTarget (e.g. "ArmorClass", "Reflex", "MaxHitPoints", "Skill").
+ * Data holds optional space-separated words: an ESGBonusType (e.g. "Dodge", defaults to Untyped) and,
+ * for skill benefits, the ESGSkillType (e.g. "Perception"). Value is applied once per stack, rounded to an integer.
  */
 USTRUCT(BlueprintType)
 struct FSGFeatBenefit
@@ -42,3 +47,29 @@ struct FSGFeatBenefit
     {
     }
 };
+
+/**
+ * One feat benefit compiled into a typed modifier-ledger write
+ */
+struct FSGFeatEffect
+{
+    ESGBonusType BonusType = ESGBonusType::Untyped;
+    ESGModifierTarget Target = ESGModifierTarget::ArmorClass;
+    ESGSkillType SkillType = ESGSkillType::Acrobatics;
+    int16 Value = 0;
+};
+
+/** Compiled effects of one feat; most feats have one or two */
+using FSGFeatEffectList = TArray<FSGFeatEffect, TInlineAllocator<2>>;
+
+namespace SGFeatBenefits
+{
+    /**
+     * Compiles authored benefits into typed effects, resolving every name once
+     * @param Benefits The authored benefits
+     * @param OutEffects Receives one effect per benefit that compiled
+     * @param OutErrors If set, receives one message per benefit that could not be compiled
+     * @return True if every benefit compiled
+     */
+    SURVIVINGGLOOMSPIRE_API bool Compile(TConstArrayView<FSGFeatBenefit> Benefits, FSGFeatEffectList& OutEffects, TArray<FText>* OutErrors = nullptr);
+}
@@ -1,16 +1,57 @@
 // Copyright 2025 Surviving Gloomspire Team. All Rights Reserved.
 
 #include "SGFeatData.h"
+#include "SGFeatPrerequisiteProgram.h"
+#include "SGEnumNames.h"
 #include "SGCharacterBase.h"
-#include "SGSkillComponent.h"
+#include "SGLog.h"
+
+#if WITH_EDITOR
+#include "Misc/DataValidation.h"
+#endif
+
+#define LOCTEXT_NAMESPACE "SGFeatData"
+
+const FPrimaryAssetType USGFeatData::PrimaryAssetType(TEXT("Feat"));
 
 USGFeatData::USGFeatData()
     : FeatType(ESGFeatType::MAX)
+    , FeatCategory(ESGFeatCategory::General)
     , bCanTakeMultipleTimes(false)
     , MaxStackCount(1)
 {
 }
 
+FPrimaryAssetId USGFeatData::GetPrimaryAssetId() const
+{
+    return FPrimaryAssetId(PrimaryAssetType, GetFName());
+}
+
+void USGFeatData::PostLoad()
+{
+    Super::PostLoad();
+    
+#if WITH_EDITORONLY_DATA
+    if (!Category_DEPRECATED.IsNone())
+    {
+        if (!ResolveCategory(Category_DEPRECATED, FeatCategory))
+        {
+            UE_LOG(LogSGFeats, Warning, TEXT("SGFeatData: %s has unknown category '%s'"), *GetName(), *Category_DEPRECATED.ToString());
+        }
+        Category_DEPRECATED = NAME_None;
+    }
+#endif
+}
+
+bool USGFeatData::ResolveCategory(FName CategoryName, ESGFeatCategory& OutCategory)
+{
+    // Display names come from UMETA, which only editor builds keep; entry names match in every build
+    const UEnum* Enum = StaticEnum<ESGFeatCategory>();
+    return !CategoryName.IsNone()
+        && SGEnumNames::Resolve(CategoryName.ToString(), SGFeatCategoryCount,
+            [Enum](ESGFeatCategory Category) { return Enum->GetDisplayNameTextByValue(static_cast<int64>(Category)); }, OutCategory);
+}
+
 FText USGFeatData::GetPrerequisitesText() const
 {
     if (Prerequisites.Num() == 0)
@@ -37,118 +78,41 @@ bool USGFeatData::ArePrerequisitesMet(ASGCharacterBase* Character) const
         return false;
     }
     
-    for (const FSGFeatPrerequisite& Prereq : Prerequisites)
-    {
-        if (!CheckPrerequisite(Prereq, Character))
-        {
-            return false;
-        }
-    }
-    
-    return true;
+    FSGPrerequisiteProgram Program;
+    SGFeatPrerequisites::Compile(Prerequisites, Program);
+    return Program.Evaluate(FSGCharacterSnapshot::Capture(Character));
 }
 
-void USGFeatData::ApplyBenefits(ASGCharacterBase* Character, int32 StackCount) const
+#if WITH_EDITOR
+EDataValidationResult USGFeatData::IsDataValid(FDataValidationContext& Context) const
 {
-    if (!Character)
-    {
-        return;
-    }
-    
-    // Apply each benefit
-    for (const FSGFeatBenefit& Benefit : Benefits)
-    {
-        // TODO: Implement benefit application based on BenefitType
-        // This will be expanded as we implement specific feat benefits
-    }
-}
+    EDataValidationResult Result = Super::IsDataValid(Context);
 
-void USGFeatData::RemoveBenefits(ASGCharacterBase* Character) const
-{
-    if (!Character)
+    if (FeatType >= ESGFeatType::MAX)
     {
-        return;
+        Context.AddError(LOCTEXT("MissingFeatType", "Feat type is not set"));
+        Result = EDataValidationResult::Invalid;
     }
-    
-    // Remove each benefit
-    for (const FSGFeatBenefit& Benefit : Benefits)
-    {
-        // TODO: Implement benefit removal based on BenefitType
-        // This will be expanded as we implement specific feat benefits
-    }
-}
 
-bool USGFeatData::CheckPrerequisite(const FSGFeatPrerequisite& Prereq, ASGCharacterBase* Character) const
-{
-    if (!Character)
+    if (FeatCategory >= ESGFeatCategory::MAX)
     {
-        return false;
+        Context.AddError(LOCTEXT("InvalidCategory", "Feat category is not valid"));
+        Result = EDataValidationResult::Invalid;
     }
-    
-    switch (Prereq.PrerequisiteType)
+
+    TArray<FText> Errors;
+    FSGPrerequisiteProgram Program;
+    FSGFeatEffectList Effects;
+    SGFeatPrerequisites::Compile(Prerequisites, Program, &Errors);
+    SGFeatBenefits::Compile(Benefits, Effects, &Errors);
+    for (const FText& Error : Errors)
     {
-        case ESGFeatPrerequisiteType::None:
-            return true;
-            
-        case ESGFeatPrerequisiteType::Level:
-            if (USGClassComponent* ClassComp = Character->GetClassComponent())
-            {
-                return ClassComp->GetTotalLevels() >= Prereq.Value;
-            }
-            return false;
-            
-        case ESGFeatPrerequisiteType::Attribute:
-        {
-            // Prereq.Subtype should be the attribute name (e.g., "Strength")
-            // Prereq.Value is the minimum attribute score required
-            // TODO: Implement attribute check
-            return false;
-        }
-            
-        case ESGFeatPrerequisiteType::BaseAttackBonus:
-            // TODO: Implement BAB check
-            return false;
-            
-        case ESGFeatPrerequisiteType::SkillRank:
-        {
-            // Prereq.Subtype should be the skill name
-            // Prereq.Value is the minimum rank required
-            if (USGSkillComponent* SkillComp = Character->GetSkillComponent())
-            {
-                // TODO: Look up skill type by name
-                // int32 Ranks = SkillComp->GetSkillRanks(SkillType);
-                // return Ranks >= Prereq.Value;
-            }
-            return false;
-        }
-            
-        case ESGFeatPrerequisiteType::Feat:
-        {
-            // Prereq.Subtype should be the feat name
-            // TODO: Implement feat check
-            return false;
-        }
-            
-        case ESGFeatPrerequisiteType::ClassLevel:
-        {
-            // Prereq.Subtype should be the class name
-            // Prereq.Value is the minimum level required
-            // TODO: Implement class level check
-            return false;
-        }
-            
-        case ESGFeatPrerequisiteType::CasterLevel:
-            // TODO: Implement caster level check
-            return false;
-            
-        case ESGFeatPrerequisiteType::Race:
-        case ESGFeatPrerequisiteType::Alignment:
-        case ESGFeatPrerequisiteType::Size:
-        case ESGFeatPrerequisiteType::Special:
-            // These will be implemented as needed
-            return false;
-            
-        default:
-            return false;
+        Context.AddError(Error);
+        Result = EDataValidationResult::Invalid;
     }
+
+    return Result;
 }
+#endif
+
+#undef LOCTEXT_NAMESPACE
@@ -3,16 +3,18 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
 #include "SGFeatTypes.h"
 #include "SGFeatPrerequisite.h"
 #include "SGFeatBenefit.h"
 #include "SGFeatData.generated.h"
 
 /**
- * Data class that defines the properties of a feat
+ * Data asset that defines the properties of a feat.
+ * Feat assets are loaded once by USGFeatRegistry and shared by every character.
  */
 UCLASS(Blueprintable, BlueprintType)
-class SURVIVINGGLOOMSPIRE_API USGFeatData : public UObject
+class SURVIVINGGLOOMSPIRE_API USGFeatData : public UPrimaryDataAsset
 {
     GENERATED_BODY()
 
@@ -33,7 +35,13 @@ public:
     
     // Category of the feat (Combat, Metamagic, Item Creation, etc.)
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Feat")
-    FName Category;
+    ESGFeatCategory FeatCategory;
+    
+#if WITH_EDITORONLY_DATA
+    // Legacy name-based category, migrated into FeatCategory on load
+    UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Use FeatCategory instead."))
+    FName Category_DEPRECATED;
+#endif
     
     // Whether this feat can be taken multiple times
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Feat")
@@ -53,33 +61,42 @@ public:
     
     // Whether this feat is a combat feat
     UFUNCTION(BlueprintCallable, Category = "Feat")
-    bool IsCombatFeat() const { return Category == FName("Combat"); }
+    bool IsCombatFeat() const { return FeatCategory == ESGFeatCategory::Combat; }
     
     // Whether this feat is a metamagic feat
     UFUNCTION(BlueprintCallable, Category = "Feat")
-    bool IsMetamagicFeat() const { return Category == FName("Metamagic"); }
+    bool IsMetamagicFeat() const { return FeatCategory == ESGFeatCategory::Metamagic; }
     
     // Whether this feat is an item creation feat
     UFUNCTION(BlueprintCallable, Category = "Feat")
-    bool IsItemCreationFeat() const { return Category == FName("ItemCreation"); }
+    bool IsItemCreationFeat() const { return FeatCategory == ESGFeatCategory::ItemCreation; }
     
     // Get all prerequisites as a formatted text
     UFUNCTION(BlueprintCallable, Category = "Feat")
     FText GetPrerequisitesText() const;
     
-    // Check if a character meets all prerequisites for this feat
+    // Check if a character meets all prerequisites for this feat.
+    // Compiles the prerequisites on every call; runtime code should use USGFeatRegistry::MeetsPrerequisites.
     UFUNCTION(BlueprintCallable, Category = "Feat")
     bool ArePrerequisitesMet(class ASGCharacterBase* Character) const;
     
-    // Apply this feat's benefits to a character
-    UFUNCTION(BlueprintCallable, Category = "Feat")
-    void ApplyBenefits(class ASGCharacterBase* Character, int32 StackCount = 1) const;
+    //~ Begin UPrimaryDataAsset Interface
+    virtual FPrimaryAssetId GetPrimaryAssetId() const override;
+    //~ End UPrimaryDataAsset Interface
     
-    // Remove this feat's benefits from a character
-    UFUNCTION(BlueprintCallable, Category = "Feat")
-    void RemoveBenefits(class ASGCharacterBase* Character) const;
+    //~ Begin UObject Interface
+    virtual void PostLoad() override;
+#if WITH_EDITOR
+    virtual EDataValidationResult IsDataValid(FDataValidationContext& Context) const override;
+#endif
+    //~ End UObject Interface
+    
+    /**
+     * Resolves a category name such as "Combat" or "ItemCreation"
+     * @return True if the name matched a category
+     */
+    static bool ResolveCategory(FName CategoryName, ESGFeatCategory& OutCategory);
     
-protected:
-    // Check if a specific prerequisite is met
-    bool CheckPrerequisite(const FSGFeatPrerequisite& Prereq, class ASGCharacterBase* Character) const;
+    /** Primary asset type every feat asset is registered under */
+    static const FPrimaryAssetType PrimaryAssetType;
 };
@@ -0,0 +1,196 @@
+// Copyright 2025 Surviving Gloomspire Team. All Rights Reserved.
+
+#include "SGFeatPrerequisiteProgram.h"
+#include "SGFeatPrerequisite.h"
+#include "SGCharacterBase.h"
+#include "SGClassComponent.h"
+#include "SGCompileDiagnostics.h"
+#include "SGDisplayNames.h"
+#include "SGEnumNames.h"
+#include "SGFeatComponent.h"
+#include "SGSkillComponent.h"
+
+#define LOCTEXT_NAMESPACE "SGFeatPrerequisites"
+
+FSGCharacterSnapshot FSGCharacterSnapshot::Capture(const ASGCharacterBase* Character)
+{
+    FSGCharacterSnapshot Snapshot;
+    if (!Character)
+    {
+        return Snapshot;
+    }
+
+    const FSGAttributeBlock& Attributes = Character->GetAttributeBlock();
+    for (int32 Index = 0; Index < SGAttributeCount; ++Index)
+    {
+        Snapshot.AttributeScores[Index] = static_cast<int16>(Attributes.GetScore(static_cast<ESGAttributeType>(Index)));
+    }
+
+    if (const USGClassComponent* ClassComponent = Character->GetClassComponent())
+    {
+        Snapshot.TotalLevel = static_cast<int16>(ClassComponent->GetTotalLevels());
+        Snapshot.BaseAttackBonus = static_cast<int16>(ClassComponent->GetBaseAttackBonus());
+        for (const FSGCharacterClassLevel& ClassLevel : ClassComponent->GetClassLevels())
+        {
+            const int32 ClassIndex = static_cast<int32>(ClassLevel.ClassType);
+            if (ClassIndex < SGClassTypeCount)
+            {
+                Snapshot.ClassLevels[ClassIndex] = static_cast<uint8>(FMath::Clamp(Snapshot.ClassLevels[ClassIndex] + ClassLevel.Level, 0, static_cast<int32>(MAX_uint8)));
+            }
+        }
+    }
+
+    if (const USGSkillComponent* SkillComponent = Character->GetSkillComponent())
+    {
+        FMemory::Memcpy(Snapshot.SkillRanks, SkillComponent->GetSkills().Ranks, sizeof(Snapshot.SkillRanks));
+    }
+
+    if (const USGFeatComponent* FeatComponent = Character->GetFeatComponent())
+    {
+        Snapshot.OwnedFeatMask = FeatComponent->GetOwnedFeatMask();
+    }
+
+    return Snapshot;
+}
+
+namespace SGFeatPrerequisites
+{
+    namespace Private
+    {
+        FText GetTypeText(ESGFeatPrerequisiteType Type)
+        {
+            return StaticEnum<ESGFeatPrerequisiteType>()->GetDisplayNameTextByValue(static_cast<int64>(Type));
+        }
+    }
+
+    bool ResolveAttribute(FName Name, ESGAttributeType& OutAttribute)
+    {
+        return !Name.IsNone()
+            && SGEnumNames::Resolve(Name.ToString(), SGAttributeCount,
+                [](ESGAttributeType Attribute) { return FSGDisplayNames::GetAttribute(Attribute).DisplayText; }, OutAttribute);
+    }
+
+    bool ResolveSkill(FName Name, ESGSkillType& OutSkill)
+    {
+        return !Name.IsNone()
+            && SGEnumNames::Resolve(Name.ToString(), SGSkillCount,
+                [](ESGSkillType Skill) { return FSGDisplayNames::GetSkill(Skill).DisplayText; }, OutSkill);
+    }
+
+    bool ResolveFeat(FName Name, ESGFeatType& OutFeat)
+    {
+        return !Name.IsNone() && SGEnumNames::Resolve(Name.ToString(), SGFeatCount, OutFeat);
+    }
+
+    bool ResolveClass(FName Name, ESGClassType& OutClass)
+    {
+        // None is not a class a prerequisite can name
+        return !Name.IsNone()
+            && SGEnumNames::Resolve(Name.ToString(), SGClassTypeCount,
+                [](ESGClassType Class) { return FSGDisplayNames::GetClass(Class).DisplayText; }, OutClass)
+            && OutClass != ESGClassType::None;
+    }
+
+    bool Compile(TConstArrayView<FSGFeatPrerequisite> Prerequisites, FSGPrerequisiteProgram& OutProgram, TArray<FText>* OutErrors)
+    {
+        OutProgram.Reset();
+        FSGCompileDiagnostics Diagnostics(OutErrors);
+
+        for (int32 Index = 0; Index < Prerequisites.Num(); ++Index)
+        {
+            const FSGFeatPrerequisite& Prereq = Prerequisites[Index];
+
+            FSGPrerequisiteInstruction Instruction;
+            Instruction.Value = static_cast<int16>(FMath::Clamp(Prereq.Value, static_cast<int32>(MIN_int16), static_cast<int32>(MAX_int16)));
+
+            FText Error;
+            switch (Prereq.PrerequisiteType)
+            {
+            case ESGFeatPrerequisiteType::None:
+                continue;
+
+            case ESGFeatPrerequisiteType::Level:
+                Instruction.Op = ESGPrerequisiteOp::Level;
+                break;
+
+            case ESGFeatPrerequisiteType::BaseAttackBonus:
+                Instruction.Op = ESGPrerequisiteOp::BaseAttackBonus;
+                break;
+
+            case ESGFeatPrerequisiteType::Attribute:
+            {
+                ESGAttributeType Attribute;
+                if (ResolveAttribute(Prereq.Subtype, Attribute))
+                {
+                    Instruction.Op = ESGPrerequisiteOp::Attribute;
+                    Instruction.Operand = static_cast<uint8>(Attribute);
+                }
+                else
+                {
+                    Error = FText::Format(LOCTEXT("UnknownAttribute", "Prerequisite {0}: unknown attribute '{1}'"), Index, FText::FromName(Prereq.Subtype));
+                }
+                break;
+            }
+
+            case ESGFeatPrerequisiteType::SkillRank:
+            {
+                ESGSkillType Skill;
+                if (ResolveSkill(Prereq.Subtype, Skill))
+                {
+                    Instruction.Op = ESGPrerequisiteOp::SkillRank;
+                    Instruction.Operand = static_cast<uint8>(Skill);
+                }
+                else
+                {
+                    Error = FText::Format(LOCTEXT("UnknownSkill", "Prerequisite {0}: unknown skill '{1}'"), Index, FText::FromName(Prereq.Subtype));
+                }
+                break;
+            }
+
+            case ESGFeatPrerequisiteType::Feat:
+            {
+                ESGFeatType Feat;
+                if (ResolveFeat(Prereq.Subtype, Feat))
+                {
+                    OutProgram.RequiredFeatMask |= SGFeats::Bit(Feat);
+                    continue;
+                }
+                Error = FText::Format(LOCTEXT("UnknownFeat", "Prerequisite {0}: unknown feat '{1}'"), Index, FText::FromName(Prereq.Subtype));
+                break;
+            }
+
+            case ESGFeatPrerequisiteType::ClassLevel:
+            {
+                ESGClassType Class;
+                if (ResolveClass(Prereq.Subtype, Class))
+                {
+                    Instruction.Op = ESGPrerequisiteOp::ClassLevel;
+                    Instruction.Operand = static_cast<uint8>(Class);
+                }
+                else
+                {
+                    Error = FText::Format(LOCTEXT("UnknownClass", "Prerequisite {0}: unknown class '{1}'"), Index, FText::FromName(Prereq.Subtype));
+                }
+                break;
+            }
+
+            default:
+                // Caster level, race, alignment, size and special prerequisites have no character data to test yet
+                Error = FText::Format(LOCTEXT("Unsupported", "Prerequisite {0}: {1} prerequisites are not supported"), Index, Private::GetTypeText(Prereq.PrerequisiteType));
+                break;
+            }
+
+            if (!Error.IsEmpty())
+            {
+                Instruction.Op = ESGPrerequisiteOp::Fail;
+                Diagnostics.AddError(MoveTemp(Error));
+            }
+
+            OutProgram.Instructions.Add(Instruction);
+        }
+
+        return Diagnostics.AllCompiled();
+    }
+}
+
+#undef LOCTEXT_NAMESPACE
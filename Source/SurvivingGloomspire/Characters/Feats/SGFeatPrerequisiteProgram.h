@@ -0,0 +1,177 @@
+// Copyright 2025 Surviving Gloomspire Team. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SGAttributeType.h"
+#include "SGClassType.h"
+#include "SGFeatTypes.h"
+#include "SGSkillType.h"
+
+class ASGCharacterBase;
+struct FSGFeatPrerequisite;
+
+/**
+ * Everything a feat prerequisite can test, copied out of a character once so many feats can be
+ * evaluated against it without touching components.
+ */
+struct SURVIVINGGLOOMSPIRE_API FSGCharacterSnapshot
+{
+    int16 TotalLevel = 0;
+    int16 BaseAttackBonus = 0;
+
+    /** Ability scores indexed by ESGAttributeType */
+    int16 AttributeScores[SGAttributeCount] = {};
+
+    /** Ranks indexed by ESGSkillType */
+    uint8 SkillRanks[SGSkillCount] = {};
+
+    /** Levels indexed by ESGClassType */
+    uint8 ClassLevels[SGClassTypeCount] = {};
+
+    /** Bit per owned feat, see SGFeats::Bit */
+    uint64 OwnedFeatMask = 0;
+
+    /** Captures a character's current state; an empty snapshot for null */
+    static FSGCharacterSnapshot Capture(const ASGCharacterBase* Character);
+};
+
+/**
+ * Prerequisite inputs that changed on a character, used to find the feats whose eligibility may have flipped
+ */
+struct FSGPrerequisiteInputChange
+{
+    /** Bit per ESGAttributeType whose score changed */
+    uint8 Attributes = 0;
+
+    /** Character level, base attack bonus or class levels changed */
+    bool bProgression = false;
+
+    /** Bit per ESGSkillType whose ranks changed */
+    uint64 Skills = 0;
+
+    /** Bit per ESGFeatType gained or lost */
+    uint64 Feats = 0;
+
+    bool IsEmpty() const { return Attributes == 0 && !bProgression && Skills == 0 && Feats == 0; }
+
+    void Append(const FSGPrerequisiteInputChange& Other)
+    {
+        Attributes |= Other.Attributes;
+        bProgression |= Other.bProgression;
+        Skills |= Other.Skills;
+        Feats |= Other.Feats;
+    }
+};
+
+/**
+ * Operation of one compiled prerequisite. Every operand is an enum index resolved at compile time.
+ */
+enum class ESGPrerequisiteOp : uint8
+{
+    /** Never satisfied; used for prerequisites that cannot be checked */
+    Fail,
+
+    /** TotalLevel >= Value */
+    Level,
+
+    /** AttributeScores[Operand] >= Value */
+    Attribute,
+
+    /** BaseAttackBonus >= Value */
+    BaseAttackBonus,
+
+    /** SkillRanks[Operand] >= Value */
+    SkillRank,
+
+    /** ClassLevels[Operand] >= Value */
+    ClassLevel
+};
+
+struct FSGPrerequisiteInstruction
+{
+    ESGPrerequisiteOp Op = ESGPrerequisiteOp::Fail;
+    uint8 Operand = 0;
+    int16 Value = 0;
+};
+
+/**
+ * A feat's prerequisites compiled into a flat list of numeric comparisons.
+ * Feat prerequisites are folded into a single required-feat mask, so evaluation is one mask test
+ * plus a few integer compares with no name lookups.
+ */
+struct SURVIVINGGLOOMSPIRE_API FSGPrerequisiteProgram
+{
+    /** Feats the character must own */
+    uint64 RequiredFeatMask = 0;
+
+    /** Remaining checks; all must pass */
+    TArray<FSGPrerequisiteInstruction, TInlineAllocator<4>> Instructions;
+
+    void Reset()
+    {
+        RequiredFeatMask = 0;
+        Instructions.Reset();
+    }
+
+    /** Whether a character in the given state meets every prerequisite */
+    bool Evaluate(const FSGCharacterSnapshot& Snapshot) const
+    {
+        if ((Snapshot.OwnedFeatMask & RequiredFeatMask) != RequiredFeatMask)
+        {
+            return false;
+        }
+
+        for (const FSGPrerequisiteInstruction& Instruction : Instructions)
+        {
+            int32 Actual;
+            switch (Instruction.Op)
+            {
+            case ESGPrerequisiteOp::Level:
+                Actual = Snapshot.TotalLevel;
+                break;
+            case ESGPrerequisiteOp::Attribute:
+                Actual = Snapshot.AttributeScores[Instruction.Operand];
+                break;
+            case ESGPrerequisiteOp::BaseAttackBonus:
+                Actual = Snapshot.BaseAttackBonus;
+                break;
+            case ESGPrerequisiteOp::SkillRank:
+                Actual = Snapshot.SkillRanks[Instruction.Operand];
+                break;
+            case ESGPrerequisiteOp::ClassLevel:
+                Actual = Snapshot.ClassLevels[Instruction.Operand];
+                break;
+            default:
+                return false;
+            }
+
+            if (Actual < Instruction.Value)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+};
+
+namespace SGFeatPrerequisites
+{
+    /**
+     * Compiles authored prerequisites into a program, resolving every Subtype name to an enum index.
+     * Subtypes match either the enum entry name (e.g. "STR", "KnowledgeArcana") or, for attributes, skills and
+     * classes, the source display name in FSGDisplayNames (e.g. "Strength", "Knowledge (Arcana)"), ignoring case.
+     * Both are available in cooked builds. Feats match their entry names only.
+     * @param Prerequisites The authored prerequisites
+     * @param OutProgram Receives the program; prerequisites that fail to compile become Fail instructions
+     * @param OutErrors If set, receives one message per prerequisite that could not be compiled
+     * @return True if every prerequisite compiled
+     */
+    SURVIVINGGLOOMSPIRE_API bool Compile(TConstArrayView<FSGFeatPrerequisite> Prerequisites, FSGPrerequisiteProgram& OutProgram, TArray<FText>* OutErrors = nullptr);
+
+    SURVIVINGGLOOMSPIRE_API bool ResolveAttribute(FName Name, ESGAttributeType& OutAttribute);
+    SURVIVINGGLOOMSPIRE_API bool ResolveSkill(FName Name, ESGSkillType& OutSkill);
+    SURVIVINGGLOOMSPIRE_API bool ResolveFeat(FName Name, ESGFeatType& OutFeat);
+    SURVIVINGGLOOMSPIRE_API bool ResolveClass(FName Name, ESGClassType& OutClass);
+}
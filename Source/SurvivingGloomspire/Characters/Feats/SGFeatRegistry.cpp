@@ -0,0 +1,154 @@
+// Copyright 2025 Surviving Gloomspire Team. All Rights Reserved.
+
+#include "SGFeatRegistry.h"
+#include "SGFeatData.h"
+#include "SGSkillData.h"
+#include "SGLog.h"
+
+void USGFeatRegistry::Initialize(FSubsystemCollectionBase& Collection)
+{
+    FeatsByType.Init(nullptr, SGFeatCount);
+    PrerequisitesByType.SetNum(SGFeatCount);
+    EffectsByType.SetNum(SGFeatCount);
+
+    // Starts the load, which may register every feat before returning
+    Super::Initialize(Collection);
+}
+
+void USGFeatRegistry::Deinitialize()
+{
+    FeatsByType.Reset();
+    PrerequisitesByType.Reset();
+    EffectsByType.Reset();
+    FMemory::Memzero(FeatsByAttribute);
+    FMemory::Memzero(FeatsBySkill);
+    FMemory::Memzero(FeatsByFeat);
+    FeatsByProgression = 0;
+
+    Super::Deinitialize();
+}
+
+USGFeatRegistry* USGFeatRegistry::Get(const UObject* WorldContextObject)
+{
+    return GetRegistry<USGFeatRegistry>(WorldContextObject);
+}
+
+uint64 USGFeatRegistry::GetEligibleFeatMask(const FSGCharacterSnapshot& Snapshot) const
+{
+    uint64 EligibleMask = 0;
+    for (int32 Index = 0; Index < FeatsByType.Num(); ++Index)
+    {
+        if (FeatsByType[Index] && PrerequisitesByType[Index].Evaluate(Snapshot))
+        {
+            EligibleMask |= SGFeats::Bit(static_cast<ESGFeatType>(Index));
+        }
+    }
+    return EligibleMask;
+}
+
+uint64 USGFeatRegistry::GetDependentFeats(const FSGPrerequisiteInputChange& Change) const
+{
+    uint64 Dependents = Change.bProgression ? FeatsByProgression : 0;
+
+    for (uint32 Remaining = Change.Attributes; Remaining; Remaining &= Remaining - 1)
+    {
+        Dependents |= FeatsByAttribute[FMath::CountTrailingZeros(Remaining)];
+    }
+    for (uint64 Remaining = Change.Skills & SGSkills::AllSkillsMask; Remaining; Remaining &= Remaining - 1)
+    {
+        Dependents |= FeatsBySkill[FMath::CountTrailingZeros64(Remaining)];
+    }
+    for (uint64 Remaining = Change.Feats; Remaining; Remaining &= Remaining - 1)
+    {
+        const int32 Index = FMath::CountTrailingZeros64(Remaining);
+        if (Index < SGFeatCount)
+        {
+            Dependents |= FeatsByFeat[Index];
+        }
+    }
+
+    return Dependents;
+}
+
+void USGFeatRegistry::IndexDependencies(ESGFeatType FeatType, const FSGPrerequisiteProgram& Program)
+{
+    const uint64 FeatBit = SGFeats::Bit(FeatType);
+
+    for (uint64 Remaining = Program.RequiredFeatMask; Remaining; Remaining &= Remaining - 1)
+    {
+        FeatsByFeat[FMath::CountTrailingZeros64(Remaining)] |= FeatBit;
+    }
+
+    for (const FSGPrerequisiteInstruction& Instruction : Program.Instructions)
+    {
+        switch (Instruction.Op)
+        {
+        case ESGPrerequisiteOp::Attribute:
+            FeatsByAttribute[Instruction.Operand] |= FeatBit;
+            break;
+        case ESGPrerequisiteOp::SkillRank:
+            FeatsBySkill[Instruction.Operand] |= FeatBit;
+            break;
+        case ESGPrerequisiteOp::Level:
+        case ESGPrerequisiteOp::BaseAttackBonus:
+        case ESGPrerequisiteOp::ClassLevel:
+            FeatsByProgression |= FeatBit;
+            break;
+        default:
+            // Fail never changes, so nothing can flip it
+            break;
+        }
+    }
+}
+
+FPrimaryAssetType USGFeatRegistry::GetPrimaryAssetType() const
+{
+    return USGFeatData::PrimaryAssetType;
+}
+
+bool USGFeatRegistry::RegisterAsset(const FPrimaryAssetId& AssetId, UObject* Asset)
+{
+    const USGFeatData* FeatData = Cast<USGFeatData>(Asset);
+    if (!FeatData)
+    {
+        UE_LOG(LogSGFeats, Warning, TEXT("SGFeatRegistry: Failed to load %s"), *AssetId.ToString());
+        return false;
+    }
+
+    if (FeatData->FeatType >= ESGFeatType::MAX)
+    {
+        UE_LOG(LogSGFeats, Warning, TEXT("SGFeatRegistry: %s has no feat type"), *AssetId.ToString());
+        return false;
+    }
+
+    TObjectPtr<const USGFeatData>& Slot = FeatsByType[static_cast<uint8>(FeatData->FeatType)];
+    if (Slot)
+    {
+        UE_LOG(LogSGFeats, Warning, TEXT("SGFeatRegistry: %s and %s both define feat %d, keeping the first"),
+            *GetNameSafe(Slot), *AssetId.ToString(), static_cast<int32>(FeatData->FeatType));
+        return false;
+    }
+
+    Slot = FeatData;
+
+    // Resolve every prerequisite and benefit name now so evaluation never touches strings
+    const uint8 FeatIndex = static_cast<uint8>(FeatData->FeatType);
+    FSGPrerequisiteProgram& Program = PrerequisitesByType[FeatIndex];
+    TArray<FText> Errors;
+    SGFeatPrerequisites::Compile(FeatData->Prerequisites, Program, &Errors);
+    SGFeatBenefits::Compile(FeatData->Benefits, EffectsByType[FeatIndex], &Errors);
+    for (const FText& Error : Errors)
+    {
+        UE_LOG(LogSGFeats, Warning, TEXT("SGFeatRegistry: %s: %s"), *AssetId.ToString(), *Error.ToString());
+    }
+    IndexDependencies(FeatData->FeatType, Program);
+    return true;
+}
+
+void USGFeatRegistry::HandleAssetsLoaded()
+{
+    UE_LOG(LogSGFeats, Log, TEXT("SGFeatRegistry: Loaded %d of %d feats in %.1f ms"),
+        GetNumLoadedAssets(), SGFeatCount, GetLoadTimeSeconds() * 1000.0f);
+
+    OnFeatsLoaded.Broadcast(GetNumLoadedAssets());
+}
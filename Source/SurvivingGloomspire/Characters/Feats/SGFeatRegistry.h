@@ -0,0 +1,122 @@
+// Copyright 2025 Surviving Gloomspire Team. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SGDataAssetRegistry.h"
+#include "SGFeatTypes.h"
+#include "SGFeatPrerequisiteProgram.h"
+#include "SGFeatBenefit.h"
+#include "SGFeatRegistry.generated.h"
+
+class USGFeatData;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnSGFeatsLoaded, int32, NumFeats);
+
+/**
+ * Loads every feat data asset through the Asset Manager when the game instance starts and
+ * keeps them in a table indexed by ESGFeatType.
+ *
+ * Feat data is immutable at runtime: the registry hands out const pointers that stay valid for the
+ * lifetime of the game instance, so components can cache them instead of looking feats up again.
+ */
+UCLASS()
+class SURVIVINGGLOOMSPIRE_API USGFeatRegistry : public USGDataAssetRegistry
+{
+    GENERATED_BODY()
+
+public:
+    //~ Begin USubsystem Interface
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    //~ End USubsystem Interface
+
+    /** Gets the feat registry for an object's game instance, or null outside a game */
+    static USGFeatRegistry* Get(const UObject* WorldContextObject);
+
+    /**
+     * Gets the data for a feat
+     * @param FeatType The feat to look up
+     * @return The feat data, or null if no asset defines the feat or loading has not finished
+     */
+    const USGFeatData* GetFeatData(ESGFeatType FeatType) const
+    {
+        const int32 FeatIndex = static_cast<int32>(FeatType);
+        return FeatsByType.IsValidIndex(FeatIndex) ? FeatsByType[FeatIndex].Get() : nullptr;
+    }
+
+    /** Gets the feat table indexed by ESGFeatType; entries without an asset are null */
+    TConstArrayView<TObjectPtr<const USGFeatData>> GetAllFeatData() const { return FeatsByType; }
+
+    /**
+     * Gets a feat's prerequisites, compiled when the feat loaded
+     * @return The program, or null if no asset defines the feat
+     */
+    const FSGPrerequisiteProgram* GetPrerequisiteProgram(ESGFeatType FeatType) const
+    {
+        return GetFeatData(FeatType) ? &PrerequisitesByType[static_cast<uint8>(FeatType)] : nullptr;
+    }
+
+    /**
+     * Checks a feat's prerequisites against a character snapshot
+     * @return False if the prerequisites are not met or no asset defines the feat
+     */
+    bool MeetsPrerequisites(ESGFeatType FeatType, const FSGCharacterSnapshot& Snapshot) const
+    {
+        const FSGPrerequisiteProgram* Program = GetPrerequisiteProgram(FeatType);
+        return Program && Program->Evaluate(Snapshot);
+    }
+
+    /**
+     * Gets a feat's benefits, compiled when the feat loaded
+     * @return The effects written per stack; empty if no asset defines the feat
+     */
+    TConstArrayView<FSGFeatEffect> GetBenefitEffects(ESGFeatType FeatType) const
+    {
+        return GetFeatData(FeatType) ? TConstArrayView<FSGFeatEffect>(EffectsByType[static_cast<uint8>(FeatType)]) : TConstArrayView<FSGFeatEffect>();
+    }
+
+    /**
+     * Gets every feat whose prerequisites a character snapshot meets, owned or not
+     * @return Bit per eligible feat, see SGFeats::Bit
+     */
+    uint64 GetEligibleFeatMask(const FSGCharacterSnapshot& Snapshot) const;
+
+    /**
+     * Gets the feats whose prerequisites read any of the changed inputs
+     * @return Bit per dependent feat, see SGFeats::Bit
+     */
+    uint64 GetDependentFeats(const FSGPrerequisiteInputChange& Change) const;
+
+    /** Broadcast once the initial asset load has finished */
+    UPROPERTY(BlueprintAssignable, Category = "Feats")
+    FOnSGFeatsLoaded OnFeatsLoaded;
+
+protected:
+    //~ Begin USGDataAssetRegistry Interface
+    virtual FPrimaryAssetType GetPrimaryAssetType() const override;
+    virtual bool RegisterAsset(const FPrimaryAssetId& AssetId, UObject* Asset) override;
+    virtual void HandleAssetsLoaded() override;
+    //~ End USGDataAssetRegistry Interface
+
+private:
+
+    /** Feat data indexed by ESGFeatType */
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<const USGFeatData>> FeatsByType;
+
+    /** Compiled prerequisites indexed by ESGFeatType */
+    TArray<FSGPrerequisiteProgram> PrerequisitesByType;
+
+    /** Compiled benefits indexed by ESGFeatType */
+    TArray<FSGFeatEffectList> EffectsByType;
+
+    /** Adds a feat's compiled prerequisites to the reverse dependency index */
+    void IndexDependencies(ESGFeatType FeatType, const FSGPrerequisiteProgram& Program);
+
+    /** Reverse dependency index: feats whose prerequisites read each input */
+    uint64 FeatsByAttribute[SGAttributeCount] = {};
+    uint64 FeatsBySkill[SGSkillCount] = {};
+    uint64 FeatsByFeat[SGFeatCount] = {};
+    uint64 FeatsByProgression = 0;
+};
@@ -42,6 +42,48 @@ enum class ESGFeatType : uint8
     MAX UMETA(Hidden)
 };
 
+/**
+ * Feat categories
+ */
+UENUM(BlueprintType)
+enum class ESGFeatCategory : uint8
+{
+    General         UMETA(DisplayName = "General"),
+    Combat          UMETA(DisplayName = "Combat"),
+    Metamagic       UMETA(DisplayName = "Metamagic"),
+    ItemCreation    UMETA(DisplayName = "Item Creation"),
+    Teamwork        UMETA(DisplayName = "Teamwork"),
+    
+    MAX             UMETA(Hidden)
+};
+
+/** Number of feat categories, used to size enum-indexed category arrays */
+constexpr int32 SGFeatCategoryCount = static_cast<int32>(ESGFeatCategory::MAX);
+
+/** Number of feats, used to size enum-indexed feat arrays */
+constexpr int32 SGFeatCount = static_cast<int32>(ESGFeatType::MAX);
+
+namespace SGFeats
+{
+    constexpr uint64 Bit(ESGFeatType FeatType)
+    {
+        return uint64(1) << static_cast<uint8>(FeatType);
+    }
+
+    /** Builds a mask from a list of feats, e.g. MakeMask({ ESGFeatType::Dodge, ESGFeatType::Mobility }) */
+    constexpr uint64 MakeMask(std::initializer_list<ESGFeatType> FeatTypes)
+    {
+        uint64 Mask = 0;
+        for (const ESGFeatType FeatType : FeatTypes)
+        {
+            Mask |= Bit(FeatType);
+        }
+        return Mask;
+    }
+
+    static_assert(SGFeatCount <= 64, "Feat flags must fit in a uint64");
+}
+
 /**
  * Types of prerequisites that can be required for a feat
  */
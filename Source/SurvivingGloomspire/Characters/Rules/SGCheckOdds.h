@@ -0,0 +1,276 @@
+// Copyright 2025 Surviving Gloomspire Team. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SGArmorClass.h"
+#include "SGSkillData.h"
+#include "SGCheckOdds.generated.h"
+
+/**
+ * Kind of d20 check, which decides whether natural 1s and 20s are automatic
+ */
+UENUM(BlueprintType)
+enum class ESGCheckKind : uint8
+{
+    SkillCheck      UMETA(DisplayName = "Skill Check"),
+    SavingThrow     UMETA(DisplayName = "Saving Throw"),
+    AttackRoll      UMETA(DisplayName = "Attack Roll")
+};
+
+/**
+ * How the d20 is used for a check
+ */
+UENUM(BlueprintType)
+enum class ESGCheckMode : uint8
+{
+    Roll            UMETA(DisplayName = "Roll"),
+    Take10          UMETA(DisplayName = "Take 10"),
+    Take20          UMETA(DisplayName = "Take 20")
+};
+
+/**
+ * Which armor class an attack is made against
+ */
+UENUM(BlueprintType)
+enum class ESGArmorClassType : uint8
+{
+    Normal          UMETA(DisplayName = "Normal"),
+    Touch           UMETA(DisplayName = "Touch"),
+    FlatFooted      UMETA(DisplayName = "Flat-Footed")
+};
+
+/**
+ * Exact outcome distribution of a single d20 check
+ */
+USTRUCT(BlueprintType)
+struct FSGCheckOdds
+{
+    GENERATED_BODY()
+
+    FSGCheckOdds()
+        : SuccessChance(0.0f)
+        , CriticalChance(0.0f)
+        , ExpectedMargin(0.0f)
+        , ExpectedMarginOnSuccess(0.0f)
+        , ExpectedMarginOnFailure(0.0f)
+        , SuccessfulRolls(0)
+    {}
+
+    /** Chance the check succeeds, 0-1 */
+    UPROPERTY(BlueprintReadOnly, Category = "Check")
+    float SuccessChance;
+
+    /** Chance of a confirmed critical hit; only set for attack rolls */
+    UPROPERTY(BlueprintReadOnly, Category = "Check")
+    float CriticalChance;
+
+    /** Mean of roll plus bonus minus DC over all outcomes */
+    UPROPERTY(BlueprintReadOnly, Category = "Check")
+    float ExpectedMargin;
+
+    /** Mean margin of the successful outcomes; can be negative when only a natural 20 succeeds */
+    UPROPERTY(BlueprintReadOnly, Category = "Check")
+    float ExpectedMarginOnSuccess;
+
+    /** Mean margin of the failed outcomes; can be positive when only a natural 1 fails */
+    UPROPERTY(BlueprintReadOnly, Category = "Check")
+    float ExpectedMarginOnFailure;
+
+    /** Number of the 20 die faces that succeed (20 or 0 when taking 10 or 20) */
+    UPROPERTY(BlueprintReadOnly, Category = "Check")
+    int32 SuccessfulRolls;
+};
+
+/**
+ * Closed-form d20 odds for the AI and UI.
+ *
+ * A check depends only on Need = DC - Bonus, and every Need below 2 or above 20 behaves the same,
+ * so the outcome of every bonus/DC pair is precomputed into constexpr tables indexed by the clamped Need.
+ * A query is a clamp, two table reads and a few multiplies.
+ */
+namespace SGCheckOdds
+{
+    /** Number of distinct Need values, from "every face succeeds" to "no face succeeds" */
+    constexpr int32 NumNeedValues = 21;
+
+    namespace Private
+    {
+        struct FNeedEntry
+        {
+            /** Faces that succeed */
+            int8 Successes;
+
+            /** Sum of the faces that succeed */
+            int16 SuccessRollSum;
+        };
+
+        constexpr FNeedEntry MakeEntry(int32 NeedIndex, bool bAutomaticRolls)
+        {
+            // NeedIndex 0 means a natural 1 would succeed, NeedIndex 20 means nothing succeeds
+            const int32 Need = NeedIndex + 1;
+            FNeedEntry Entry = { 0, 0 };
+            for (int32 Roll = 1; Roll <= 20; ++Roll)
+            {
+                bool bSuccess = Roll >= Need;
+                if (bAutomaticRolls)
+                {
+                    bSuccess = Roll == 20 || (Roll != 1 && bSuccess);
+                }
+                if (bSuccess)
+                {
+                    ++Entry.Successes;
+                    Entry.SuccessRollSum += static_cast<int16>(Roll);
+                }
+            }
+            return Entry;
+        }
+
+        template<bool bAutomaticRolls>
+        struct TNeedTable
+        {
+            FNeedEntry Entries[NumNeedValues];
+
+            constexpr TNeedTable()
+                : Entries()
+            {
+                for (int32 Index = 0; Index < NumNeedValues; ++Index)
+                {
+                    Entries[Index] = MakeEntry(Index, bAutomaticRolls);
+                }
+            }
+        };
+
+        /** Skill and ability checks: the die is taken at face value */
+        constexpr TNeedTable<false> PlainTable;
+
+        /** Saves and attacks: a natural 1 always fails and a natural 20 always succeeds */
+        constexpr TNeedTable<true> AutomaticTable;
+
+        static_assert(PlainTable.Entries[0].Successes == 20 && PlainTable.Entries[20].Successes == 0, "Plain d20 table is out of range");
+        static_assert(AutomaticTable.Entries[0].Successes == 19 && AutomaticTable.Entries[20].Successes == 1, "Natural 1 and 20 must be automatic");
+        static_assert(AutomaticTable.Entries[10].SuccessRollSum == 11 + 12 + 13 + 14 + 15 + 16 + 17 + 18 + 19 + 20, "DC 11 vs +0 succeeds on 11-20");
+
+        constexpr int32 GetNeedIndex(int32 Bonus, int32 DifficultyClass)
+        {
+            const int32 Index = DifficultyClass - Bonus - 1;
+            return Index < 0 ? 0 : (Index >= NumNeedValues ? NumNeedValues - 1 : Index);
+        }
+
+        constexpr int32 RollSum = 20 * 21 / 2;
+    }
+
+    /** Whether natural 1s and 20s are automatic for a kind of check */
+    constexpr bool HasAutomaticRolls(ESGCheckKind Kind)
+    {
+        return Kind != ESGCheckKind::SkillCheck;
+    }
+
+    /**
+     * Gets the exact odds of a d20 check
+     * @param Kind Kind of check, which decides the natural 1 and 20 rules
+     * @param Bonus Total bonus added to the roll
+     * @param DifficultyClass DC (or armor class) to meet
+     * @param Mode Roll, or take 10 / take 20 for a deterministic result; only skill checks may take 10 or 20
+     * @param ThreatRange Lowest natural roll that threatens a critical hit; attack rolls only
+     */
+    inline FSGCheckOdds GetOdds(ESGCheckKind Kind, int32 Bonus, int32 DifficultyClass, ESGCheckMode Mode = ESGCheckMode::Roll, int32 ThreatRange = 20)
+    {
+        FSGCheckOdds Odds;
+
+        // Saves and attacks are always rolled, so treat a take 10 / take 20 request for them as a roll
+        if (Mode != ESGCheckMode::Roll && !ensureMsgf(Kind == ESGCheckKind::SkillCheck, TEXT("Only skill checks can take 10 or take 20")))
+        {
+            Mode = ESGCheckMode::Roll;
+        }
+
+        if (Mode != ESGCheckMode::Roll)
+        {
+            // Taking 10 or 20 has no die roll, so natural 1 and 20 rules never apply
+            const int32 Margin = (Mode == ESGCheckMode::Take10 ? 10 : 20) + Bonus - DifficultyClass;
+            const bool bSuccess = Margin >= 0;
+            Odds.SuccessChance = bSuccess ? 1.0f : 0.0f;
+            Odds.ExpectedMargin = static_cast<float>(Margin);
+            Odds.ExpectedMarginOnSuccess = bSuccess ? static_cast<float>(Margin) : 0.0f;
+            Odds.ExpectedMarginOnFailure = bSuccess ? 0.0f : static_cast<float>(Margin);
+            Odds.SuccessfulRolls = bSuccess ? 20 : 0;
+            return Odds;
+        }
+
+        const bool bAutomaticRolls = HasAutomaticRolls(Kind);
+        const Private::FNeedEntry* Table = bAutomaticRolls ? Private::AutomaticTable.Entries : Private::PlainTable.Entries;
+        const Private::FNeedEntry& Entry = Table[Private::GetNeedIndex(Bonus, DifficultyClass)];
+
+        const int32 Offset = Bonus - DifficultyClass;
+        const int32 Successes = Entry.Successes;
+        const int32 Failures = 20 - Successes;
+
+        Odds.SuccessfulRolls = Successes;
+        Odds.SuccessChance = Successes / 20.0f;
+        Odds.ExpectedMargin = 10.5f + Offset;
+        Odds.ExpectedMarginOnSuccess = Successes > 0 ? static_cast<float>(Entry.SuccessRollSum) / Successes + Offset : 0.0f;
+        Odds.ExpectedMarginOnFailure = Failures > 0 ? static_cast<float>(Private::RollSum - Entry.SuccessRollSum) / Failures + Offset : 0.0f;
+
+        if (Kind == ESGCheckKind::AttackRoll)
+        {
+            // A threat needs a natural roll in the threat range that also hits; the confirmation roll repeats the attack
+            const int32 FirstThreat = FMath::Clamp(FMath::Max(ThreatRange, DifficultyClass - Bonus), 2, 20);
+            const int32 Threats = bAutomaticRolls && ThreatRange <= 20 ? 21 - FirstThreat : 0;
+            Odds.CriticalChance = (Threats / 20.0f) * Odds.SuccessChance;
+        }
+
+        return Odds;
+    }
+
+    /**
+     * Gets the odds of a skill check
+     * @param Skill The skill being used; a trained-only skill without ranks always fails
+     * @param AbilityModifier Modifier of the skill's key ability
+     * @param MiscModifier Any other modifiers
+     */
+    inline FSGCheckOdds GetSkillCheckOdds(const FSGSkillData& Skill, int32 AbilityModifier, int32 MiscModifier, int32 DifficultyClass, ESGCheckMode Mode = ESGCheckMode::Roll)
+    {
+        if (!Skill.CanUseSkill())
+        {
+            return FSGCheckOdds();
+        }
+        return GetOdds(ESGCheckKind::SkillCheck, Skill.CalculateTotalBonus(AbilityModifier, MiscModifier), DifficultyClass, Mode);
+    }
+
+    /**
+     * Gets the odds of a saving throw
+     */
+    inline FSGCheckOdds GetSaveOdds(int32 SaveBonus, int32 DifficultyClass)
+    {
+        return GetOdds(ESGCheckKind::SavingThrow, SaveBonus, DifficultyClass);
+    }
+
+    /**
+     * Gets the odds of an attack roll against a target's armor class
+     * @param AttackBonus Total attack bonus
+     * @param ArmorClass Target's armor class
+     * @param DexterityModifier Target's Dexterity modifier
+     * @param AgainstType Normal, touch or flat-footed AC
+     * @param SizeModifier Target's size modifier to AC
+     * @param OtherModifiers Any other modifiers to the target's AC
+     * @param ThreatRange Lowest natural roll that threatens a critical hit
+     */
+    inline FSGCheckOdds GetAttackOdds(int32 AttackBonus, const FSGArmorClass& ArmorClass, int32 DexterityModifier, ESGArmorClassType AgainstType = ESGArmorClassType::Normal,
+        int32 SizeModifier = 0, int32 OtherModifiers = 0, int32 ThreatRange = 20)
+    {
+        int32 TargetAC;
+        switch (AgainstType)
+        {
+        case ESGArmorClassType::Touch:
+            TargetAC = ArmorClass.CalculateTouchAC(DexterityModifier, SizeModifier, OtherModifiers);
+            break;
+        case ESGArmorClassType::FlatFooted:
+            TargetAC = ArmorClass.CalculateFlatFootedAC(SizeModifier, OtherModifiers);
+            break;
+        default:
+            TargetAC = ArmorClass.CalculateTotalAC(DexterityModifier, SizeModifier, OtherModifiers);
+            break;
+        }
+        return GetOdds(ESGCheckKind::AttackRoll, AttackBonus, TargetAC, ESGCheckMode::Roll, ThreatRange);
+    }
+}
@@ -0,0 +1,170 @@
+// Copyright 2025 Surviving Gloomspire Team. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SGDiceStream.generated.h"
+
+/**
+ * What a dice stream is used for. Each purpose gets its own stream so adding a roll of one kind
+ * never shifts the rolls of another.
+ */
+UENUM(BlueprintType)
+enum class ESGDicePurpose : uint8
+{
+    General         UMETA(DisplayName = "General"),
+    SkillCheck      UMETA(DisplayName = "Skill Check"),
+    SavingThrow     UMETA(DisplayName = "Saving Throw"),
+    AttackRoll      UMETA(DisplayName = "Attack Roll"),
+    Damage          UMETA(DisplayName = "Damage"),
+    Initiative      UMETA(DisplayName = "Initiative"),
+    Loot            UMETA(DisplayName = "Loot"),
+    AI              UMETA(DisplayName = "AI")
+};
+
+namespace SGDice
+{
+    /** SplitMix64 finalizer; a bijective 64-bit mix */
+    FORCEINLINE constexpr uint64 Mix64(uint64 Value)
+    {
+        Value += 0x9E3779B97F4A7C15ull;
+        Value = (Value ^ (Value >> 30)) * 0xBF58476D1CE4E5B9ull;
+        Value = (Value ^ (Value >> 27)) * 0x94D049BB133111EBull;
+        return Value ^ (Value >> 31);
+    }
+
+    /** Random value number Counter of the stream identified by Key */
+    FORCEINLINE constexpr uint64 Generate(uint64 Key, uint64 Counter)
+    {
+        return Mix64(Mix64(Counter) ^ Key);
+    }
+
+    /** Maps a 64-bit random value to [1, Sides] */
+    FORCEINLINE constexpr int32 ToDie(uint64 Random, int32 Sides)
+    {
+        // Multiply-shift on the high 32 bits; the bias for any die size is below 2^-26
+        return static_cast<int32>(((Random >> 32) * static_cast<uint64>(Sides)) >> 32) + 1;
+    }
+}
+
+/**
+ * Counter-based dice stream.
+ *
+ * Every roll is a pure function of the stream key and a counter, so a stream is just two integers:
+ * it can be copied to a worker thread and rolled without locks, split into independent child streams,
+ * jumped forward, and saved and restored to reproduce every later roll bit for bit.
+ */
+USTRUCT(BlueprintType)
+struct FSGDiceStream
+{
+    GENERATED_BODY()
+
+    FSGDiceStream()
+        : Key(0)
+        , Counter(0)
+    {}
+
+    explicit FSGDiceStream(uint64 InKey, uint64 InCounter = 0)
+        : Key(InKey)
+        , Counter(InCounter)
+    {}
+
+    /**
+     * Creates the stream for a character and purpose within an encounter
+     * @param Seed Session or replay seed
+     * @param EncounterId Encounter the rolls belong to
+     * @param CharacterId Stable identifier of the rolling character
+     * @param Purpose What the rolls are for
+     */
+    static FSGDiceStream Make(uint64 Seed, uint32 EncounterId, uint32 CharacterId, ESGDicePurpose Purpose)
+    {
+        uint64 StreamKey = SGDice::Mix64(Seed);
+        StreamKey = SGDice::Mix64(StreamKey ^ EncounterId);
+        StreamKey = SGDice::Mix64(StreamKey ^ CharacterId);
+        StreamKey = SGDice::Mix64(StreamKey ^ static_cast<uint64>(Purpose));
+        return FSGDiceStream(StreamKey);
+    }
+
+    /**
+     * Creates an independent child stream, e.g. one per worker task
+     * @param SubStreamId Identifies the child; the same id always gives the same child
+     */
+    FSGDiceStream Fork(uint64 SubStreamId) const
+    {
+        return FSGDiceStream(SGDice::Mix64(Key ^ SGDice::Mix64(SubStreamId ^ 0xD1CE5EEDull)));
+    }
+
+    /** Gets the next raw 64-bit value */
+    FORCEINLINE uint64 Next()
+    {
+        return SGDice::Generate(Key, Counter++);
+    }
+
+    /** Rolls a single die with the given number of sides (at least 1) */
+    FORCEINLINE int32 RollDie(int32 Sides)
+    {
+        checkSlow(Sides >= 1);
+        return SGDice::ToDie(Next(), Sides);
+    }
+
+    FORCEINLINE int32 RollD20()
+    {
+        return RollDie(20);
+    }
+
+    /**
+     * Rolls NumDice dice and adds a modifier, e.g. 3d6+2
+     */
+    int32 Roll(int32 NumDice, int32 Sides, int32 Modifier = 0)
+    {
+        int32 Total = Modifier;
+        for (int32 Index = 0; Index < NumDice; ++Index)
+        {
+            Total += RollDie(Sides);
+        }
+        return Total;
+    }
+
+    /**
+     * Rolls one die per element of the output array.
+     * Each element depends only on its own counter value, so the loop has no carried state.
+     */
+    void RollDice(int32 Sides, TArrayView<int32> OutRolls)
+    {
+        checkSlow(Sides >= 1);
+        const uint64 StreamKey = Key;
+        const uint64 FirstCounter = Counter;
+        int32* RESTRICT Rolls = OutRolls.GetData();
+        const int32 Count = OutRolls.Num();
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            Rolls[Index] = SGDice::ToDie(SGDice::Generate(StreamKey, FirstCounter + Index), Sides);
+        }
+        Counter += Count;
+    }
+
+    void RollD20s(TArrayView<int32> OutRolls)
+    {
+        RollDice(20, OutRolls);
+    }
+
+    /** Advances the stream as if Count values had been drawn */
+    void Skip(uint64 Count)
+    {
+        Counter += Count;
+    }
+
+    uint64 GetKey() const { return Key; }
+    uint64 GetCounter() const { return Counter; }
+
+    bool operator==(const FSGDiceStream& Other) const { return Key == Other.Key && Counter == Other.Counter; }
+
+private:
+    /** Identifies the stream */
+    UPROPERTY(SaveGame)
+    uint64 Key;
+
+    /** Number of values drawn so far */
+    UPROPERTY(SaveGame)
+    uint64 Counter;
+};
@@ -0,0 +1,126 @@
+// Copyright 2025 Surviving Gloomspire Team. All Rights Reserved.
+
+#include "SGDiceSubsystem.h"
+#include "SGCharacterBase.h"
+#include "SGLog.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CommandLine.h"
+#include "Misc/DateTime.h"
+#include "Misc/Parse.h"
+
+void USGDiceSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    uint64 CommandLineSeed = 0;
+    if (FParse::Value(FCommandLine::Get(), TEXT("SGDiceSeed="), CommandLineSeed))
+    {
+        SetSeed(static_cast<int64>(CommandLineSeed));
+    }
+    else
+    {
+        SetSeed(static_cast<int64>(FPlatformTime::Cycles64() ^ static_cast<uint64>(FDateTime::UtcNow().GetTicks())));
+    }
+}
+
+USGDiceSubsystem* USGDiceSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+    return GameInstance ? GameInstance->GetSubsystem<USGDiceSubsystem>() : nullptr;
+}
+
+void USGDiceSubsystem::SetSeed(int64 NewSeed)
+{
+    Seed = static_cast<uint64>(NewSeed);
+    Streams.Reset();
+    UE_LOG(LogSGCharacter, Log, TEXT("SGDice: Session seed %llu"), Seed);
+}
+
+void USGDiceSubsystem::BeginEncounter(int32 NewEncounterId)
+{
+    EncounterId = static_cast<uint32>(NewEncounterId);
+    Streams.Reset();
+}
+
+FSGDiceStream& USGDiceSubsystem::GetStream(UObject* Roller, ESGDicePurpose Purpose)
+{
+    check(IsInGameThread());
+    const uint32 RollerId = GetRollerId(Roller);
+    if (FSGDiceStream* Stream = Streams.Find(MakeStreamMapKey(RollerId, Purpose)))
+    {
+        return *Stream;
+    }
+    return Streams.Add(MakeStreamMapKey(RollerId, Purpose), FSGDiceStream::Make(Seed, EncounterId, RollerId, Purpose));
+}
+
+int32 USGDiceSubsystem::RollD20(UObject* Roller, ESGDicePurpose Purpose)
+{
+    return GetStream(Roller, Purpose).RollD20();
+}
+
+int32 USGDiceSubsystem::RollDice(UObject* Roller, ESGDicePurpose Purpose, int32 NumDice, int32 Sides, int32 Modifier)
+{
+    if (Sides < 1)
+    {
+        return Modifier;
+    }
+    return GetStream(Roller, Purpose).Roll(NumDice, Sides, Modifier);
+}
+
+FSGDiceState USGDiceSubsystem::SaveState() const
+{
+    FSGDiceState State;
+    State.Seed = static_cast<int64>(Seed);
+    State.EncounterId = static_cast<int32>(EncounterId);
+    State.NextRollerId = NextRollerId;
+    State.Streams.Reserve(Streams.Num());
+    for (const TPair<uint64, FSGDiceStream>& Elem : Streams)
+    {
+        FSGSavedDiceStream& Saved = State.Streams.AddDefaulted_GetRef();
+        Saved.RollerId = static_cast<uint32>(Elem.Key >> 8);
+        Saved.Purpose = static_cast<ESGDicePurpose>(Elem.Key & 0xFF);
+        Saved.Stream = Elem.Value;
+    }
+    return State;
+}
+
+void USGDiceSubsystem::RestoreState(const FSGDiceState& State)
+{
+    Seed = static_cast<uint64>(State.Seed);
+    EncounterId = static_cast<uint32>(State.EncounterId);
+    NextRollerId = FMath::Max(State.NextRollerId, 1u);
+    OtherRollerIds.Reset();
+    Streams.Reset();
+    for (const FSGSavedDiceStream& Saved : State.Streams)
+    {
+        Streams.Add(MakeStreamMapKey(Saved.RollerId, Saved.Purpose), Saved.Stream);
+    }
+}
+
+uint32 USGDiceSubsystem::GetRollerId(UObject* Roller)
+{
+    if (!Roller)
+    {
+        return 0;
+    }
+
+    // Characters save their identifier, so their streams survive save and load
+    if (ASGCharacterBase* Character = Cast<ASGCharacterBase>(Roller))
+    {
+        if (Character->GetDiceRollerId() == 0)
+        {
+            Character->SetDiceRollerId(NextRollerId++);
+        }
+        return Character->GetDiceRollerId();
+    }
+
+    uint32& RollerId = OtherRollerIds.FindOrAdd(Roller, 0);
+    if (RollerId == 0)
+    {
+        RollerId = NextRollerId++;
+    }
+    return RollerId;
+}
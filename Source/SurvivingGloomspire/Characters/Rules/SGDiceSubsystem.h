@@ -0,0 +1,152 @@
+// Copyright 2025 Surviving Gloomspire Team. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "SGDiceStream.h"
+#include "SGDiceSubsystem.generated.h"
+
+/**
+ * Saved position of one dice stream
+ */
+USTRUCT(BlueprintType)
+struct FSGSavedDiceStream
+{
+    GENERATED_BODY()
+
+    FSGSavedDiceStream()
+        : RollerId(0)
+        , Purpose(ESGDicePurpose::General)
+    {}
+
+    UPROPERTY(SaveGame)
+    uint32 RollerId;
+
+    UPROPERTY(SaveGame)
+    ESGDicePurpose Purpose;
+
+    UPROPERTY(SaveGame)
+    FSGDiceStream Stream;
+};
+
+/**
+ * Everything needed to reproduce the rolls that follow a save or replay point
+ */
+USTRUCT(BlueprintType)
+struct FSGDiceState
+{
+    GENERATED_BODY()
+
+    FSGDiceState()
+        : Seed(0)
+        , EncounterId(0)
+        , NextRollerId(1)
+    {}
+
+    UPROPERTY(SaveGame)
+    int64 Seed;
+
+    UPROPERTY(SaveGame)
+    int32 EncounterId;
+
+    /** Next roller identifier to hand out, so rollers created after a load never reuse a saved one */
+    UPROPERTY(SaveGame)
+    uint32 NextRollerId;
+
+    UPROPERTY(SaveGame)
+    TArray<FSGSavedDiceStream> Streams;
+};
+
+/**
+ * Owns the session dice seed and hands out one counter-based stream per (roller, purpose) within
+ * the current encounter. Streams are created lazily and live until the next encounter begins.
+ *
+ * Streams are keyed by a roller identifier the subsystem assigns on a roller's first roll. Characters
+ * keep theirs in a SaveGame property, so their streams line up again after a load regardless of
+ * object names or spawn order; other objects keep theirs for the session only.
+ *
+ * Stream lookup is game-thread only; worker threads should copy or Fork a stream and roll on the copy.
+ * The seed can be fixed with -SGDiceSeed=<number> for balance simulations and replays.
+ */
+UCLASS()
+class SURVIVINGGLOOMSPIRE_API USGDiceSubsystem : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    //~ Begin USubsystem Interface
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    //~ End USubsystem Interface
+
+    /** Gets the dice subsystem for an object's game instance, or null outside a game */
+    static USGDiceSubsystem* Get(const UObject* WorldContextObject);
+
+    /**
+     * Sets the session seed and discards every stream
+     */
+    UFUNCTION(BlueprintCallable, Category = "Dice")
+    void SetSeed(int64 NewSeed);
+
+    UFUNCTION(BlueprintPure, Category = "Dice")
+    int64 GetSeed() const { return static_cast<int64>(Seed); }
+
+    /**
+     * Starts a new encounter; every roller gets fresh streams keyed by the encounter
+     */
+    UFUNCTION(BlueprintCallable, Category = "Dice")
+    void BeginEncounter(int32 NewEncounterId);
+
+    UFUNCTION(BlueprintPure, Category = "Dice")
+    int32 GetEncounterId() const { return static_cast<int32>(EncounterId); }
+
+    /**
+     * Gets the stream for a roller and purpose, creating it on first use
+     * @param Roller The character or other object rolling
+     * @param Purpose What the rolls are for
+     */
+    FSGDiceStream& GetStream(UObject* Roller, ESGDicePurpose Purpose);
+
+    /**
+     * Rolls a d20 from a roller's stream
+     */
+    UFUNCTION(BlueprintCallable, Category = "Dice")
+    int32 RollD20(UObject* Roller, ESGDicePurpose Purpose = ESGDicePurpose::General);
+
+    /**
+     * Rolls NumDice dice with the given number of sides plus a modifier from a roller's stream
+     */
+    UFUNCTION(BlueprintCallable, Category = "Dice")
+    int32 RollDice(UObject* Roller, ESGDicePurpose Purpose, int32 NumDice, int32 Sides, int32 Modifier = 0);
+
+    /** Captures the seed, encounter and every stream position */
+    UFUNCTION(BlueprintCallable, Category = "Dice")
+    FSGDiceState SaveState() const;
+
+    /** Restores a state captured by SaveState */
+    UFUNCTION(BlueprintCallable, Category = "Dice")
+    void RestoreState(const FSGDiceState& State);
+
+    /**
+     * Gets the identifier used to key a roller's streams, assigning one on first use
+     * @param Roller The character or other object rolling
+     * @return The identifier, or 0 for a null roller
+     */
+    uint32 GetRollerId(UObject* Roller);
+
+private:
+    static uint64 MakeStreamMapKey(uint32 RollerId, ESGDicePurpose Purpose)
+    {
+        return (static_cast<uint64>(RollerId) << 8) | static_cast<uint64>(Purpose);
+    }
+
+    uint64 Seed = 0;
+    uint32 EncounterId = 0;
+    uint32 NextRollerId = 1;
+
+    /** Identifiers assigned to rollers that are not characters and so have nowhere to save one */
+    TMap<TObjectKey<UObject>, uint32> OtherRollerIds;
+
+    /** Streams of the current encounter keyed by MakeStreamMapKey */
+    TMap<uint64, FSGDiceStream> Streams;
+};
@@ -0,0 +1,365 @@
+// Copyright 2025 Surviving Gloomspire Team. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SGAttributeType.h"
+#include "SGSkillType.h"
+#include "SGClassType.h"
+#include "SGSavingThrows.h"
+
+/**
+ * Compile-time Pathfinder 1e rules tables.
+ * Every lookup here is a constexpr table read; the static_asserts at the bottom of each
+ * section check the tables against the formulas from the Core Rulebook.
+ */
+namespace SGRules
+{
+    // ======================================================================
+    // Ability Modifiers
+    // ======================================================================
+
+    constexpr int32 MinAbilityScore = 1;
+    constexpr int32 MaxAbilityScore = 30;
+
+    /** Ability modifier for scores 0-30, indexed by score */
+    constexpr int8 AbilityModifierTable[MaxAbilityScore + 1] =
+    {
+        -5,                                 // 0
+        -5, -4, -4, -3, -3, -2, -2, -1, -1, // 1-9
+         0,  0,  1,  1,  2,  2,  3,  3,  4, // 10-18
+         4,  5,  5,  6,  6,  7,  7,  8,  8, // 19-27
+         9,  9, 10                          // 28-30
+    };
+
+    /**
+     * Gets the ability modifier for a score
+     * @param Score Ability score, clamped to 0-30
+     * @return floor((Score - 10) / 2)
+     */
+    constexpr int32 GetAbilityModifier(int32 Score)
+    {
+        return AbilityModifierTable[Score < 0 ? 0 : (Score > MaxAbilityScore ? MaxAbilityScore : Score)];
+    }
+
+    namespace Private
+    {
+        constexpr int32 FloorHalf(int32 Value)
+        {
+            return Value >= 0 ? Value / 2 : -((1 - Value) / 2);
+        }
+
+        constexpr bool ValidateAbilityModifiers()
+        {
+            for (int32 Score = 0; Score <= MaxAbilityScore; ++Score)
+            {
+                if (AbilityModifierTable[Score] != FloorHalf(Score - 10))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+
+    static_assert(Private::ValidateAbilityModifiers(), "AbilityModifierTable must match floor((Score - 10) / 2)");
+    static_assert(GetAbilityModifier(10) == 0 && GetAbilityModifier(11) == 0 && GetAbilityModifier(9) == -1, "Modifier around 10");
+    static_assert(GetAbilityModifier(-3) == -5 && GetAbilityModifier(45) == 10, "Out-of-range scores clamp to the table");
+
+    // ======================================================================
+    // Experience
+    // ======================================================================
+
+    constexpr int32 MaxTableLevel = 20;
+
+    /** XP required to reach each level on the medium advancement track, indexed by level - 1 */
+    constexpr int32 XPTable[MaxTableLevel] =
+    {
+        0,       // Level 1
+        2000,    // 2
+        5000,    // 3
+        9000,    // 4
+        15000,   // 5
+        23000,   // 6
+        35000,   // 7
+        51000,   // 8
+        75000,   // 9
+        105000,  // 10
+        155000,  // 11
+        220000,  // 12
+        315000,  // 13
+        445000,  // 14
+        635000,  // 15
+        890000,  // 16
+        1300000, // 17
+        1800000, // 18
+        2550000, // 19
+        3600000  // 20
+    };
+
+    /** XP added per level beyond the end of the table */
+    constexpr int32 XPPerEpicLevel = 1000000;
+
+    /**
+     * Gets the total XP required to reach a level
+     * @param Level Character level (levels beyond 20 add XPPerEpicLevel each)
+     */
+    constexpr int32 GetXPForLevel(int32 Level)
+    {
+        if (Level <= 1)
+        {
+            return 0;
+        }
+        if (Level <= MaxTableLevel)
+        {
+            return XPTable[Level - 1];
+        }
+        return XPTable[MaxTableLevel - 1] + (Level - MaxTableLevel) * XPPerEpicLevel;
+    }
+
+    /**
+     * Gets the highest level reachable with the given XP (binary search over XPTable)
+     * @param XP Total experience points
+     * @return Character level, at least 1
+     */
+    constexpr int32 GetLevelForXP(int32 XP)
+    {
+        if (XP >= XPTable[MaxTableLevel - 1])
+        {
+            return MaxTableLevel + (XP - XPTable[MaxTableLevel - 1]) / XPPerEpicLevel;
+        }
+
+        // Find the first entry greater than XP; the level is its index
+        int32 Low = 0;
+        int32 High = MaxTableLevel - 1;
+        while (Low < High)
+        {
+            const int32 Mid = (Low + High) / 2;
+            if (XPTable[Mid] <= XP)
+            {
+                Low = Mid + 1;
+            }
+            else
+            {
+                High = Mid;
+            }
+        }
+        return Low < 1 ? 1 : Low;
+    }
+
+    namespace Private
+    {
+        constexpr bool ValidateXPTable()
+        {
+            for (int32 Index = 1; Index < MaxTableLevel; ++Index)
+            {
+                if (XPTable[Index] <= XPTable[Index - 1])
+                {
+                    return false;
+                }
+            }
+            for (int32 Level = 1; Level <= MaxTableLevel + 5; ++Level)
+            {
+                if (GetLevelForXP(GetXPForLevel(Level)) != Level || GetLevelForXP(GetXPForLevel(Level + 1) - 1) != Level)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+
+    static_assert(XPTable[0] == 0, "Level 1 requires no experience");
+    static_assert(Private::ValidateXPTable(), "XPTable must be strictly increasing and round-trip through GetLevelForXP");
+    static_assert(GetLevelForXP(-100) == 1 && GetLevelForXP(1999) == 1 && GetLevelForXP(2000) == 2, "Level-from-XP boundaries");
+
+    // ======================================================================
+    // Skills
+    // ======================================================================
+
+    /** Key ability for each skill, indexed by ESGSkillType */
+    constexpr ESGAttributeType SkillKeyAbilityTable[] =
+    {
+        // Physical Skills
+        ESGAttributeType::DEX, // Acrobatics
+        ESGAttributeType::STR, // Climb
+        ESGAttributeType::DEX, // EscapeArtist
+        ESGAttributeType::DEX, // Fly
+        ESGAttributeType::DEX, // Ride
+        ESGAttributeType::DEX, // Stealth
+        ESGAttributeType::STR, // Swim
+
+        // Social Skills
+        ESGAttributeType::CHA, // Bluff
+        ESGAttributeType::CHA, // Diplomacy
+        ESGAttributeType::CHA, // Disguise
+        ESGAttributeType::CHA, // HandleAnimal
+        ESGAttributeType::CHA, // Intimidate
+        ESGAttributeType::CHA, // Perform
+
+        // Knowledge Skills
+        ESGAttributeType::INT, // Appraise
+        ESGAttributeType::INT, // Craft
+        ESGAttributeType::INT, // KnowledgeArcana
+        ESGAttributeType::INT, // KnowledgeDungeoneering
+        ESGAttributeType::INT, // KnowledgeEngineering
+        ESGAttributeType::INT, // KnowledgeGeography
+        ESGAttributeType::INT, // KnowledgeHistory
+        ESGAttributeType::INT, // KnowledgeLocal
+        ESGAttributeType::INT, // KnowledgeNature
+        ESGAttributeType::INT, // KnowledgeNobility
+        ESGAttributeType::INT, // KnowledgePlanes
+        ESGAttributeType::INT, // KnowledgeReligion
+        ESGAttributeType::INT, // Linguistics
+        ESGAttributeType::WIS, // Profession
+
+        // Perception Skills
+        ESGAttributeType::DEX, // DisableDevice
+        ESGAttributeType::WIS, // Perception
+        ESGAttributeType::WIS, // SenseMotive
+        ESGAttributeType::DEX, // SleightOfHand
+
+        // Other Skills
+        ESGAttributeType::WIS, // Heal
+        ESGAttributeType::INT, // Spellcraft
+        ESGAttributeType::WIS, // Survival
+        ESGAttributeType::CHA  // UseMagicDevice
+    };
+
+    /** Gets the key ability for a skill */
+    constexpr ESGAttributeType GetSkillKeyAbility(ESGSkillType SkillType)
+    {
+        return SkillKeyAbilityTable[static_cast<uint8>(SkillType)];
+    }
+
+    static_assert(UE_ARRAY_COUNT(SkillKeyAbilityTable) == SGSkillCount, "SkillKeyAbilityTable must cover every skill");
+    static_assert(GetSkillKeyAbility(ESGSkillType::Acrobatics) == ESGAttributeType::DEX, "Acrobatics is DEX");
+    static_assert(GetSkillKeyAbility(ESGSkillType::Swim) == ESGAttributeType::STR, "Swim is STR");
+    static_assert(GetSkillKeyAbility(ESGSkillType::HandleAnimal) == ESGAttributeType::CHA, "Handle Animal is CHA");
+    static_assert(GetSkillKeyAbility(ESGSkillType::KnowledgeReligion) == ESGAttributeType::INT, "Knowledge is INT");
+    static_assert(GetSkillKeyAbility(ESGSkillType::DisableDevice) == ESGAttributeType::DEX, "Disable Device is DEX");
+    static_assert(GetSkillKeyAbility(ESGSkillType::Perception) == ESGAttributeType::WIS, "Perception is WIS");
+    static_assert(GetSkillKeyAbility(ESGSkillType::UseMagicDevice) == ESGAttributeType::CHA, "Use Magic Device is CHA");
+
+    // ======================================================================
+    // Class Progressions
+    // ======================================================================
+
+    /** Base attack bonus progression rates */
+    enum class EBABProgression : uint8
+    {
+        Full,           // +1 per level
+        ThreeQuarters,  // +3/4 per level
+        Half            // +1/2 per level
+    };
+
+    /** Static progression data for a core class */
+    struct FClassProgression
+    {
+        EBABProgression BAB;
+        bool bGoodFortitude;
+        bool bGoodReflex;
+        bool bGoodWill;
+        int32 HitDie;
+        int32 SkillRanksPerLevel;
+    };
+
+    /** Progression data for each core class, indexed by ESGClassType */
+    constexpr FClassProgression ClassProgressionTable[] =
+    {
+        // BAB                            Fort   Ref    Will   HD  Ranks
+        { EBABProgression::Half,          false, false, false, 0,  0 }, // None
+        { EBABProgression::Full,          true,  false, false, 12, 4 }, // Barbarian
+        { EBABProgression::ThreeQuarters, false, true,  true,  8,  6 }, // Bard
+        { EBABProgression::ThreeQuarters, true,  false, true,  8,  2 }, // Cleric
+        { EBABProgression::ThreeQuarters, true,  false, true,  8,  4 }, // Druid
+        { EBABProgression::Full,          true,  false, false, 10, 2 }, // Fighter
+        { EBABProgression::ThreeQuarters, true,  true,  true,  8,  4 }, // Monk
+        { EBABProgression::Full,          true,  false, true,  10, 2 }, // Paladin
+        { EBABProgression::Full,          true,  true,  false, 10, 6 }, // Ranger
+        { EBABProgression::ThreeQuarters, false, true,  false, 8,  8 }, // Rogue
+        { EBABProgression::Half,          false, false, true,  6,  2 }, // Sorcerer
+        { EBABProgression::Half,          false, false, true,  6,  2 }  // Wizard
+    };
+
+    /** Base attack bonus at levels 0-20 for each progression, indexed by [EBABProgression][Level] */
+    constexpr int8 BABTable[3][MaxTableLevel + 1] =
+    {
+        { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20 }, // Full
+        { 0, 0, 1, 2, 3, 3, 4, 5, 6, 6, 7,  8,  9,  9,  10, 11, 12, 12, 13, 14, 15 }, // Three quarters
+        { 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5,  5,  6,  6,  7,  7,  8,  8,  9,  9,  10 }  // Half
+    };
+
+    /** Good base save at levels 0-20, indexed by level */
+    constexpr int8 GoodSaveTable[MaxTableLevel + 1] =
+    {
+        0, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12
+    };
+
+    /** Poor base save at levels 0-20, indexed by level */
+    constexpr int8 PoorSaveTable[MaxTableLevel + 1] =
+    {
+        0, 0, 0, 1, 1, 1, 2, 2, 2, 3, 3, 3, 4, 4, 4, 5, 5, 5, 6, 6, 6
+    };
+
+    /** Gets the static progression data for a class */
+    constexpr const FClassProgression& GetClassProgression(ESGClassType ClassType)
+    {
+        return ClassProgressionTable[static_cast<uint8>(ClassType)];
+    }
+
+    /**
+     * Gets the base attack bonus a class grants at a class level
+     * @param ClassType The class
+     * @param ClassLevel Levels taken in that class, clamped to 0-20
+     */
+    constexpr int32 GetClassBaseAttackBonus(ESGClassType ClassType, int32 ClassLevel)
+    {
+        const int32 Level = ClassLevel < 0 ? 0 : (ClassLevel > MaxTableLevel ? MaxTableLevel : ClassLevel);
+        return BABTable[static_cast<uint8>(GetClassProgression(ClassType).BAB)][Level];
+    }
+
+    /**
+     * Gets the base save a class grants at a class level
+     * @param ClassType The class
+     * @param SaveType The saving throw
+     * @param ClassLevel Levels taken in that class, clamped to 0-20
+     */
+    constexpr int32 GetClassBaseSave(ESGClassType ClassType, ESGSavingThrowType SaveType, int32 ClassLevel)
+    {
+        const FClassProgression& Progression = GetClassProgression(ClassType);
+        const bool bGood = SaveType == ESGSavingThrowType::Fortitude ? Progression.bGoodFortitude
+            : (SaveType == ESGSavingThrowType::Reflex ? Progression.bGoodReflex : Progression.bGoodWill);
+        const int32 Level = ClassLevel < 0 ? 0 : (ClassLevel > MaxTableLevel ? MaxTableLevel : ClassLevel);
+        return bGood ? GoodSaveTable[Level] : PoorSaveTable[Level];
+    }
+
+    namespace Private
+    {
+        constexpr bool ValidateProgressionTables()
+        {
+            for (int32 Level = 0; Level <= MaxTableLevel; ++Level)
+            {
+                if (BABTable[0][Level] != Level
+                    || BABTable[1][Level] != (Level * 3) / 4
+                    || BABTable[2][Level] != Level / 2
+                    || GoodSaveTable[Level] != (Level > 0 ? 2 + Level / 2 : 0)
+                    || PoorSaveTable[Level] != Level / 3)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+
+    static_assert(UE_ARRAY_COUNT(ClassProgressionTable) == SGClassTypeCount, "ClassProgressionTable must cover every class");
+    static_assert(Private::ValidateProgressionTables(), "BAB and save tables must match the Core Rulebook formulas");
+    static_assert(GetClassBaseAttackBonus(ESGClassType::Fighter, 20) == 20, "Fighter has full BAB");
+    static_assert(GetClassBaseAttackBonus(ESGClassType::Cleric, 20) == 15, "Cleric has 3/4 BAB");
+    static_assert(GetClassBaseAttackBonus(ESGClassType::Wizard, 20) == 10, "Wizard has 1/2 BAB");
+    static_assert(GetClassBaseSave(ESGClassType::Fighter, ESGSavingThrowType::Fortitude, 1) == 2, "Fighter has good Fortitude");
+    static_assert(GetClassBaseSave(ESGClassType::Fighter, ESGSavingThrowType::Will, 1) == 0, "Fighter has poor Will");
+    static_assert(GetClassBaseSave(ESGClassType::Monk, ESGSavingThrowType::Reflex, 20) == 12, "Monk has good Reflex");
+    static_assert(GetClassProgression(ESGClassType::Barbarian).HitDie == 12, "Barbarian uses d12");
+}
@@ -7,16 +7,20 @@
 #include "SGArmorClass.h"
 #include "SGSavingThrows.h"
 #include "SGClassType.h"
+#include "SGClassRegistry.h"
 #include "SGSkillComponent.h"
+#include "SGDisplayNames.h"
+#include "SGArmorClassBatch.h"
+#include "SGLog.h"
+#include "SGTrace.h"
 
-// Define the log category for this class
-DEFINE_LOG_CATEGORY_STATIC(LogSGCharacter, Log, All);
-
-// Debug logging macro for this class
+// Debug logging macro for this class; compiled out below the category's compile-time verbosity
 #define SG_LOG(Verbosity, Format, ...) \
-    if (bEnableDebugLogging) { \
-        UE_LOG(LogSGCharacter, Verbosity, TEXT("%s: ") Format, *GetName(), ##__VA_ARGS__); \
-    }
+    do { \
+        if (bEnableDebugLogging) { \
+            UE_LOG(LogSGCharacter, Verbosity, TEXT("%s: ") Format, *GetName(), ##__VA_ARGS__); \
+        } \
+    } while (0)
 
 // ======================================================================
 // Construction & Initialization
@@ -61,6 +65,13 @@ void ASGCharacterBase::BeginPlay()
         FeatComponent->Initialize(this);
     }
     
+    // Until the class assets load, BAB and saves come from the core progressions
+    USGClassRegistry* ClassRegistry = USGClassRegistry::Get(this);
+    if (ClassRegistry && !ClassRegistry->IsLoaded())
+    {
+        ClassRegistry->OnClassesLoaded.AddUniqueDynamic(this, &ASGCharacterBase::HandleClassesLoaded);
+    }
+    
     // Log initial state
     DebugLogState(true);
 }
@@ -75,18 +86,54 @@ void ASGCharacterBase::SetupPlayerInputComponent(UInputComponent* PlayerInputCom
     Super::SetupPlayerInputComponent(PlayerInputComponent);
 }
 
-void ASGCharacterBase::InitializeDefaultAttributes()
+void ASGCharacterBase::PostLoad()
+{
+    Super::PostLoad();
+    
+#if WITH_EDITORONLY_DATA
+    // Migrate attributes saved with the old map-based storage
+    if (Attributes_DEPRECATED.Num() > 0)
+    {
+        for (const auto& Elem : Attributes_DEPRECATED)
+        {
+            if (Elem.Key < ESGAttributeType::MAX)
+            {
+                AttributeBlock.SetScore(Elem.Key, FMath::Clamp(Elem.Value.BaseValue, 1, 30));
+            }
+        }
+        Attributes_DEPRECATED.Empty();
+        CalculateAllModifiers();
+    }
+#endif
+}
+
+#if WITH_EDITOR
+void ASGCharacterBase::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
 {
-    // Clear any existing attributes
-    Attributes.Reset();
+    Super::PostEditChangeProperty(PropertyChangedEvent);
     
+    // Keep modifiers and derived stats in sync with values edited directly in the details panel
+    const FName MemberName = PropertyChangedEvent.GetMemberPropertyName();
+    if (MemberName == GET_MEMBER_NAME_CHECKED(ASGCharacterBase, AttributeBlock))
+    {
+        CalculateAllModifiers();
+    }
+    else if (MemberName == GET_MEMBER_NAME_CHECKED(ASGCharacterBase, ArmorClass)
+        || MemberName == GET_MEMBER_NAME_CHECKED(ASGCharacterBase, SavingThrows)
+        || MemberName == GET_MEMBER_NAME_CHECKED(ASGCharacterBase, BaseHitPoints))
+    {
+        CalculateDerivedAttributes();
+    }
+}
+#endif
+
+void ASGCharacterBase::InitializeDefaultAttributes()
+{
     // Set default attribute values (10 is average in Pathfinder)
-    Attributes.Add(ESGAttributeType::STR, FSGAttributeData());
-    Attributes.Add(ESGAttributeType::DEX, FSGAttributeData());
-    Attributes.Add(ESGAttributeType::CON, FSGAttributeData());
-    Attributes.Add(ESGAttributeType::INT, FSGAttributeData());
-    Attributes.Add(ESGAttributeType::WIS, FSGAttributeData());
-    Attributes.Add(ESGAttributeType::CHA, FSGAttributeData());
+    AttributeBlock = FSGAttributeBlock();
+    
+    // Everything derived must be recomputed from the new defaults
+    DerivedStats.InvalidateAll();
     
     // Initialize hit points
     HitPoints = FSGHitPoints();
@@ -96,11 +143,8 @@ void ASGCharacterBase::InitializeDefaultAttributes()
     // Initialize armor class
     ArmorClass = FSGArmorClass();
     
-    // Initialize saving throws
+    // Initialize saving throws; base saves come from the class component
     SavingThrows = FSGSavingThrows();
-    SavingThrows.Fortitude.BaseSave = 2;
-    SavingThrows.Reflex.BaseSave = 0;
-    SavingThrows.Will.BaseSave = 2;
     
     // Set base hit points
     BaseHitPoints = 10;
@@ -114,14 +158,12 @@ void ASGCharacterBase::InitializeDefaultAttributes()
 
 FSGAttributeData ASGCharacterBase::GetAttribute(ESGAttributeType AttributeType) const
 {
-    const FSGAttributeData* FoundAttr = Attributes.Find(AttributeType);
-    if (FoundAttr)
+    if (!FSGAttributeBlock::IsValidType(AttributeType))
     {
-        return *FoundAttr;
+        SG_LOG(Warning, TEXT("Attribute type %d not found, returning default"), static_cast<int32>(AttributeType));
+        return FSGAttributeData();
     }
-    
-    SG_LOG(Warning, TEXT("Attribute type %d not found, returning default"), static_cast<int32>(AttributeType));
-    return FSGAttributeData();
+    return AttributeBlock.Get(AttributeType);
 }
 
 void ASGCharacterBase::SetBaseAttribute(ESGAttributeType AttributeType, int32 NewValue)
@@ -129,107 +171,396 @@ void ASGCharacterBase::SetBaseAttribute(ESGAttributeType AttributeType, int32 Ne
     // Clamp value between 1 and 30 (Pathfinder rules)
     const int32 ClampedValue = FMath::Clamp(NewValue, 1, 30);
     
-    if (FSGAttributeData* Attribute = Attributes.Find(AttributeType))
+    if (!FSGAttributeBlock::IsValidType(AttributeType))
     {
-        if (Attribute->BaseValue != ClampedValue)
-        {
-            const int32 OldValue = Attribute->BaseValue;
-            Attribute->BaseValue = ClampedValue;
-            Attribute->CalculateModifier();
-            
-            SG_LOG(Log, TEXT("Attribute %s changed: %d -> %d (Modifier: %d)"), 
-                *GetAttributeName(AttributeType), 
-                OldValue, 
-                ClampedValue, 
-                Attribute->Modifier);
-                
-            // Recalculate derived attributes that depend on this attribute
-            CalculateDerivedAttributes();
+        SG_LOG(Error, TEXT("Invalid attribute type: %d"), static_cast<int32>(AttributeType));
+        return;
+    }
+    
+    const int32 OldValue = AttributeBlock.GetScore(AttributeType);
+    if (AttributeBlock.SetScore(AttributeType, ClampedValue))
+    {
+        SG_TRACE(AttributeChanged, this, static_cast<int32>(AttributeType), OldValue, ClampedValue);
+        SG_LOG(Verbose, TEXT("Attribute %s changed: %d -> %d (Modifier: %d)"), 
+            *GetAttributeName(AttributeType), 
+            OldValue, 
+            ClampedValue, 
+            AttributeBlock.GetModifier(AttributeType));
             
+        // Only the derived stats keyed on this attribute need recomputing
+        InvalidateDerivedStats(static_cast<ESGDerivedInput>(AttributeType));
+        
+        const uint8 AttributeBit = static_cast<uint8>(1u << static_cast<uint8>(AttributeType));
+        if (AttributeTransactionDepth > 0)
+        {
+            // Notification is deferred until the transaction commits
+            PendingChangedAttributes |= AttributeBit;
+            bTransactionHasChanges = true;
+        }
+        else
+        {
             // Notify derived classes that an attribute changed
             OnAttributeChanged(AttributeType);
+            BroadcastAttributesChanged(AttributeBit);
         }
     }
-    else
+}
+
+void ASGCharacterBase::BeginAttributeTransaction()
+{
+    ++AttributeTransactionDepth;
+}
+
+void ASGCharacterBase::CommitAttributeTransaction()
+{
+    if (AttributeTransactionDepth <= 0)
+    {
+        SG_LOG(Warning, TEXT("CommitAttributeTransaction called without a matching BeginAttributeTransaction"));
+        return;
+    }
+    
+    if (--AttributeTransactionDepth > 0)
+    {
+        return;
+    }
+    
+    // Derived stats were only marked dirty during the transaction; max HP is the one stat resolved eagerly
+    if (DerivedStats.IsDirty(ESGDerivedStat::MaxHitPoints))
+    {
+        RefreshHitPoints();
+    }
+    
+    // Skill totals invalidated during the transaction are rebuilt once
+    if (SkillComponent)
+    {
+        SkillComponent->RefreshSkillBonuses();
+    }
+    
+    // As is feat eligibility
+    if (FeatComponent)
     {
-        SG_LOG(Error, TEXT("Failed to find attribute for type: %s"), *GetAttributeName(AttributeType));
+        FeatComponent->RefreshFeatEligibility();
+    }
+    
+    if (bTransactionHasChanges)
+    {
+        const uint8 ChangedMask = PendingChangedAttributes;
+        PendingChangedAttributes = 0;
+        bTransactionHasChanges = false;
+        SG_TRACE(AttributesCommitted, this, ChangedMask);
+        BroadcastAttributesChanged(ChangedMask);
     }
 }
 
-void ASGCharacterBase::CalculateAllModifiers()
+void ASGCharacterBase::ApplyAttributeChanges(const FSGAttributeChangeSet& ChangeSet)
 {
-    // Recalculate all attribute modifiers
-    for (auto& Elem : Attributes)
+    FSGScopedAttributeTransaction Transaction(this);
+    
+    for (const FSGAttributeChange& Change : ChangeSet.AttributeChanges)
     {
-        Elem.Value.CalculateModifier();
+        SetBaseAttribute(Change.AttributeType, Change.NewValue);
     }
     
+    if (ChangeSet.bOverrideBaseHitPoints && BaseHitPoints != ChangeSet.BaseHitPoints)
+    {
+        SetBaseHitPoints(ChangeSet.BaseHitPoints);
+        bTransactionHasChanges = true;
+    }
+    
+    if (ChangeSet.bOverrideTemporaryHitPoints && HitPoints.Temporary != ChangeSet.TemporaryHitPoints)
+    {
+        HitPoints.Temporary = FMath::Max(0, ChangeSet.TemporaryHitPoints);
+        bTransactionHasChanges = true;
+    }
+    
+    if (ChangeSet.bOverrideArmorBonuses)
+    {
+        ArmorClass.ArmorBonus = ChangeSet.ArmorBonus;
+        ArmorClass.ShieldBonus = ChangeSet.ShieldBonus;
+        ArmorClass.NaturalArmor = ChangeSet.NaturalArmor;
+        ArmorClass.DeflectionBonus = ChangeSet.DeflectionBonus;
+        ArmorClass.DodgeBonus = ChangeSet.DodgeBonus;
+        InvalidateDerivedStats(ESGDerivedInput::Equipment);
+        bTransactionHasChanges = true;
+    }
+}
+
+void ASGCharacterBase::BroadcastAttributesChanged(uint8 ChangedAttributeMask)
+{
+    TArray<ESGAttributeType> ChangedAttributes;
+    for (int32 Index = 0; Index < SGAttributeCount; ++Index)
+    {
+        if (ChangedAttributeMask & (1u << Index))
+        {
+            ChangedAttributes.Add(static_cast<ESGAttributeType>(Index));
+        }
+    }
+    
+    OnAttributesCommitted(ChangedAttributes);
+    OnAttributesChanged.Broadcast(this, ChangedAttributes);
+}
+
+void ASGCharacterBase::CalculateAllModifiers()
+{
+    // Recalculate all attribute modifiers
+    AttributeBlock.RecalculateModifiers();
+    
     // Recalculate derived attributes after all modifiers are updated
     CalculateDerivedAttributes();
     
-    SG_LOG(Log, TEXT("Recalculated all attribute modifiers and derived attributes"));
+    SG_LOG(Verbose, TEXT("Recalculated all attribute modifiers and derived attributes"));
 }
 
 int32 ASGCharacterBase::GetAttributeModifier(ESGAttributeType AttributeType) const
 {
-    if (const FSGAttributeData* Attribute = Attributes.Find(AttributeType))
+    if (!FSGAttributeBlock::IsValidType(AttributeType))
     {
-        return Attribute->Modifier;
+        SG_LOG(Warning, TEXT("Attribute type %d not found, returning 0"), static_cast<int32>(AttributeType));
+        return 0;
     }
-    
-    SG_LOG(Warning, TEXT("Attribute type %d not found, returning 0"), static_cast<int32>(AttributeType));
-    return 0;
+    return AttributeBlock.GetModifier(AttributeType);
 }
 
 int32 ASGCharacterBase::GetAttributeValue(ESGAttributeType AttributeType) const
 {
-    if (const FSGAttributeData* Attribute = Attributes.Find(AttributeType))
+    if (!FSGAttributeBlock::IsValidType(AttributeType))
     {
-        return Attribute->BaseValue;
+        SG_LOG(Warning, TEXT("Attribute type %d not found, returning 0"), static_cast<int32>(AttributeType));
+        return 0;
     }
-    
-    SG_LOG(Warning, TEXT("Attribute type %d not found, returning 0"), static_cast<int32>(AttributeType));
-    return 0;
+    return AttributeBlock.GetScore(AttributeType);
 }
 
-FString ASGCharacterBase::GetAttributeName(ESGAttributeType AttributeType)
+TMap<ESGAttributeType, FSGAttributeData> ASGCharacterBase::GetAllAttributes() const
 {
-    // Use GetStaticEnum with the enum type directly
-    const UEnum* EnumPtr = FindObject<UEnum>(nullptr, TEXT("/Script/SurvivingGloomspire.ESGAttributeType"), true);
-    if (!EnumPtr)
+    TMap<ESGAttributeType, FSGAttributeData> Result;
+    Result.Reserve(SGAttributeCount);
+    for (int32 Index = 0; Index < SGAttributeCount; ++Index)
     {
-        // Fallback to static find if the first approach fails
-        EnumPtr = FindFirstObject<UEnum>(TEXT("ESGAttributeType"));
-        if (!EnumPtr)
-        {
-            return FString("Unknown");
-        }
+        Result.Add(static_cast<ESGAttributeType>(Index), AttributeBlock.Values[Index]);
     }
-    
-    FString DisplayName = EnumPtr->GetDisplayNameTextByIndex(static_cast<int32>(AttributeType)).ToString();
-    return DisplayName.IsEmpty() ? FString("Unknown") : DisplayName;
+    return Result;
+}
+
+const FString& ASGCharacterBase::GetAttributeName(ESGAttributeType AttributeType)
+{
+    return FSGDisplayNames::GetAttribute(AttributeType).DisplayString;
 }
 
 // ======================================================================
 // Derived Attributes & Combat
 // ======================================================================
 
+void ASGCharacterBase::SetBaseHitPoints(int32 NewBaseHitPoints)
+{
+    if (BaseHitPoints != NewBaseHitPoints)
+    {
+        BaseHitPoints = NewBaseHitPoints;
+        InvalidateDerivedStats(ESGDerivedInput::ClassLevels);
+    }
+}
+
 void ASGCharacterBase::CalculateDerivedAttributes()
 {
-    if (!Attributes.Contains(ESGAttributeType::CON) || !Attributes.Contains(ESGAttributeType::DEX) || !Attributes.Contains(ESGAttributeType::WIS))
+    InvalidateDerivedStatMask(SGDerivedStats::AllMask);
+    RefreshHitPoints();
+    
+    SG_LOG(Verbose, TEXT("Invalidated all derived attributes"));
+}
+
+void ASGCharacterBase::InvalidateDerivedStats(ESGDerivedInput Input)
+{
+    InvalidateDerivedStatMask(SGDerivedStats::GetDependents(Input));
+    
+    // Attribute scores and class levels are also feat prerequisites; the feat component reports its own changes
+    if (FeatComponent && Input <= ESGDerivedInput::ClassLevels)
     {
-        SG_LOG(Error, TEXT("Missing required attributes for calculating derived attributes"));
-        return;
+        FSGPrerequisiteInputChange Change;
+        if (Input == ESGDerivedInput::ClassLevels)
+        {
+            Change.bProgression = true;
+        }
+        else
+        {
+            Change.Attributes = static_cast<uint8>(1u << static_cast<uint8>(Input));
+        }
+        FeatComponent->InvalidateFeatEligibility(Change);
+    }
+}
+
+void ASGCharacterBase::InvalidateDerivedStat(ESGDerivedStat Stat)
+{
+    InvalidateDerivedStatMask(SGDerivedStats::Bit(Stat));
+}
+
+void ASGCharacterBase::InvalidateDerivedStatMask(uint64 StatMask)
+{
+    // Skill totals are cached by the skill component, which rebuilds only the skills named here
+    const uint64 SkillStatMask = StatMask & SGDerivedStats::SkillMask;
+    if (SkillStatMask && SkillComponent)
+    {
+        SkillComponent->InvalidateSkills(SkillStatMask >> static_cast<uint8>(ESGDerivedStat::FirstSkill));
+    }
+    
+    DerivedStats.Invalidate(StatMask & ~SGDerivedStats::SkillMask);
+    
+    // Maximum hit points also clamp current hit points, so they are resolved right away
+    // (or once at commit when a transaction is open)
+    if (AttributeTransactionDepth == 0 && DerivedStats.IsDirty(ESGDerivedStat::MaxHitPoints))
+    {
+        RefreshHitPoints();
     }
+}
 
-    const int32 ConMod = GetAttributeModifier(ESGAttributeType::CON);
-    // Update hit points
-    const int32 NewMaxHP = FMath::Max(1, BaseHitPoints + ConMod);
+int32 ASGCharacterBase::GetDerivedStat(ESGDerivedStat Stat) const
+{
+    if (Stat >= ESGDerivedStat::FirstSkill)
+    {
+        const ESGSkillType SkillType = static_cast<ESGSkillType>(static_cast<uint8>(Stat) - static_cast<uint8>(ESGDerivedStat::FirstSkill));
+        return SkillComponent ? SkillComponent->GetSkillBonus(SkillType) : 0;
+    }
+    
+    return DerivedStats.Resolve(Stat, [this](ESGDerivedStat DirtyStat) { return ComputeDerivedStat(DirtyStat); });
+}
+
+int32 ASGCharacterBase::ComputeDerivedStat(ESGDerivedStat Stat) const
+{
+    switch (Stat)
+    {
+        case ESGDerivedStat::MaxHitPoints:
+            return FMath::Max(1, BaseHitPoints + AttributeBlock.GetModifier(ESGAttributeType::CON)
+                + ModifierLedger.GetTotal(SGModifiers::GetSlot(ESGModifierTarget::MaxHitPoints)));
+            
+        case ESGDerivedStat::ArmorClass:
+        case ESGDerivedStat::TouchArmorClass:
+        case ESGDerivedStat::FlatFootedArmorClass:
+        {
+            int32 OtherModifiers = 0;
+            const FSGArmorClass EffectiveAC = GetEffectiveArmorClass(OtherModifiers);
+            const int32 DexModifier = AttributeBlock.GetModifier(ESGAttributeType::DEX);
+            
+            if (Stat == ESGDerivedStat::ArmorClass)
+            {
+                return EffectiveAC.CalculateTotalAC(DexModifier, 0, OtherModifiers);
+            }
+            if (Stat == ESGDerivedStat::TouchArmorClass)
+            {
+                return EffectiveAC.CalculateTouchAC(DexModifier, 0, OtherModifiers);
+            }
+            return EffectiveAC.CalculateFlatFootedAC(0, OtherModifiers);
+        }
+            
+        case ESGDerivedStat::Fortitude:
+        case ESGDerivedStat::Reflex:
+        case ESGDerivedStat::Will:
+        {
+            static constexpr ESGAttributeType SaveAbilities[] = { ESGAttributeType::CON, ESGAttributeType::DEX, ESGAttributeType::WIS };
+            
+            const int32 SaveIndex = static_cast<int32>(Stat) - static_cast<int32>(ESGDerivedStat::Fortitude);
+            const ESGSavingThrowType SaveType = static_cast<ESGSavingThrowType>(SaveIndex);
+            const FSGSavingThrowData& Save = SavingThrows.GetSavingThrow(SaveType);
+            const int32 Slot = SGModifiers::GetSlot(static_cast<ESGModifierTarget>(static_cast<int32>(ESGModifierTarget::Fortitude) + SaveIndex));
+            
+            // A resistance bonus in the ledger does not stack with the one on the save itself
+            const int32 LedgerResistance = ModifierLedger.GetTypedTotal(Slot, ESGBonusType::Resistance);
+            const int32 LedgerResistanceBonus = ModifierLedger.GetTypedBonus(Slot, ESGBonusType::Resistance);
+            FSGSavingThrowData EffectiveSave = Save;
+            
+            // The base save is the sum of every class's progression; the save fields only add item and other bonuses
+            if (ClassComponent)
+            {
+                EffectiveSave.BaseSave = ClassComponent->GetBaseSave(SaveType);
+            }
+            EffectiveSave.ResistanceBonus = FMath::Max(Save.ResistanceBonus, LedgerResistanceBonus) + (LedgerResistance - LedgerResistanceBonus);
+            
+            return EffectiveSave.CalculateTotal(AttributeBlock.GetModifier(SaveAbilities[SaveIndex]))
+                + ModifierLedger.GetTotal(Slot) - LedgerResistance;
+        }
+            
+        default:
+            // Skill totals are cached by the skill component and never resolved here
+            return GetDerivedStat(Stat);
+    }
+}
+
+void ASGCharacterBase::HandleClassesLoaded(int32 NumClasses)
+{
+    if (USGClassRegistry* ClassRegistry = USGClassRegistry::Get(this))
+    {
+        ClassRegistry->OnClassesLoaded.RemoveDynamic(this, &ASGCharacterBase::HandleClassesLoaded);
+    }
+    
+    // Authored class tables may differ from the core progressions used while loading;
+    // this also re-evaluates feats gated on level, BAB or class levels
+    InvalidateDerivedStats(ESGDerivedInput::ClassLevels);
+    
+    SG_LOG(Verbose, TEXT("Class progression refreshed after %d class assets loaded"), NumClasses);
+}
+
+FSGArmorClass ASGCharacterBase::GetEffectiveArmorClass(int32& OutOtherModifiers) const
+{
+    const int32 Slot = SGModifiers::GetSlot(ESGModifierTarget::ArmorClass);
+    FSGArmorClass EffectiveAC = ArmorClass;
+    int32 TypedTotal = 0;
+    
+    // The armor class fields hold worn equipment; a ledger bonus of the same type does not stack with them
+    auto MergeTyped = [this, Slot, &TypedTotal](int32& Field, ESGBonusType BonusType)
+    {
+        const int32 Total = ModifierLedger.GetTypedTotal(Slot, BonusType);
+        const int32 Bonus = ModifierLedger.GetTypedBonus(Slot, BonusType);
+        Field = FMath::Max(Field, Bonus) + (Total - Bonus);
+        TypedTotal += Total;
+    };
+    
+    MergeTyped(EffectiveAC.ArmorBonus, ESGBonusType::Armor);
+    MergeTyped(EffectiveAC.ShieldBonus, ESGBonusType::Shield);
+    MergeTyped(EffectiveAC.NaturalArmor, ESGBonusType::NaturalArmor);
+    MergeTyped(EffectiveAC.DeflectionBonus, ESGBonusType::Deflection);
+    
+    // Dodge bonuses always stack
+    const int32 LedgerDodge = ModifierLedger.GetTypedTotal(Slot, ESGBonusType::Dodge);
+    EffectiveAC.DodgeBonus += LedgerDodge;
+    TypedTotal += LedgerDodge;
+    
+    OutOtherModifiers = ModifierLedger.GetTotal(Slot) - TypedTotal;
+    return EffectiveAC;
+}
+
+int32 ASGCharacterBase::AppendToArmorClassBatch(FSGArmorClassBatch& Batch, int32 SizeModifier) const
+{
+    int32 OtherModifiers = 0;
+    const FSGArmorClass EffectiveAC = GetEffectiveArmorClass(OtherModifiers);
+    return Batch.Add(EffectiveAC, AttributeBlock.GetModifier(ESGAttributeType::DEX), SizeModifier, OtherModifiers);
+}
+
+FSGCheckOdds ASGCharacterBase::GetSavingThrowOdds(ESGSavingThrowType SaveType, int32 DifficultyClass) const
+{
+    return SGCheckOdds::GetSaveOdds(GetSavingThrowTotal(SaveType), DifficultyClass);
+}
+
+FSGCheckOdds ASGCharacterBase::GetOddsToBeHit(int32 AttackBonus, ESGArmorClassType AgainstType, int32 ThreatRange) const
+{
+    int32 TargetAC;
+    switch (AgainstType)
+    {
+    case ESGArmorClassType::Touch:
+        TargetAC = GetTouchArmorClass();
+        break;
+    case ESGArmorClassType::FlatFooted:
+        TargetAC = GetFlatFootedArmorClass();
+        break;
+    default:
+        TargetAC = GetTotalArmorClass();
+        break;
+    }
+    return SGCheckOdds::GetOdds(ESGCheckKind::AttackRoll, AttackBonus, TargetAC, ESGCheckMode::Roll, ThreatRange);
+}
+
+void ASGCharacterBase::RefreshHitPoints()
+{
+    const int32 NewMaxHP = GetDerivedStat(ESGDerivedStat::MaxHitPoints);
     HitPoints.Max = NewMaxHP;
     HitPoints.Current = FMath::Min(HitPoints.Current, NewMaxHP);
-    
-    SG_LOG(Verbose, TEXT("Recalculated derived attributes"));
-    DebugLogState();
 }
 
 bool ASGCharacterBase::ApplyDamage(int32 Amount)
@@ -244,7 +575,8 @@ bool ASGCharacterBase::ApplyDamage(int32 Amount)
     const int32 DamageTaken = HitPoints.ApplyDamage(Amount);
     const bool bIsDefeated = (HitPoints.Current <= 0);
     
-    SG_LOG(Log, TEXT("Took %d damage (HP: %d -> %d)"), DamageTaken, OldHP, HitPoints.Current);
+    SG_TRACE(Damage, this, DamageTaken, OldHP, HitPoints.Current);
+    SG_LOG(Verbose, TEXT("Took %d damage (HP: %d -> %d)"), DamageTaken, OldHP, HitPoints.Current);
     
     // Check if character is dead
     if (bIsDefeated)
@@ -265,18 +597,123 @@ int32 ASGCharacterBase::ApplyHealing(int32 Amount)
     const int32 OldHP = HitPoints.Current;
     const int32 ActualHealing = HitPoints.Heal(Amount);
     
-    SG_LOG(Log, TEXT("Healed for %d (HP: %d -> %d)"), ActualHealing, OldHP, HitPoints.Current);
+    SG_TRACE(Healing, this, ActualHealing, OldHP, HitPoints.Current);
+    SG_LOG(Verbose, TEXT("Healed for %d (HP: %d -> %d)"), ActualHealing, OldHP, HitPoints.Current);
     
     return ActualHealing;
 }
 
+FSGHitPoints ASGCharacterBase::ApplyHitPointChanges(TConstArrayView<FSGHitPointChange> Changes)
+{
+    const FSGHitPoints OldHitPoints = HitPoints;
+    
+    int32 DamageTaken = 0;
+    int32 Healed = 0;
+    HitPoints.ApplyChanges(Changes, DamageTaken, Healed);
+    
+    if (DamageTaken > 0)
+    {
+        SG_TRACE(Damage, this, DamageTaken, OldHitPoints.Current, HitPoints.Current);
+    }
+    if (Healed > 0)
+    {
+        SG_TRACE(Healing, this, Healed, OldHitPoints.Current, HitPoints.Current);
+    }
+    SG_LOG(Verbose, TEXT("Applied %d hit point changes: %d damage, %d healing (HP: %d -> %d)"),
+        Changes.Num(), DamageTaken, Healed, OldHitPoints.Current, HitPoints.Current);
+    
+    return OldHitPoints;
+}
+
+// ======================================================================
+// Modifiers
+// ======================================================================
+
+FSGModifierHandle ASGCharacterBase::AddModifier(FName Source, ESGBonusType BonusType, ESGModifierTarget Target, int32 Value, ESGSkillType SkillType)
+{
+    if (BonusType >= ESGBonusType::MAX || Target >= ESGModifierTarget::MAX || SkillType >= ESGSkillType::MAX)
+    {
+        SG_LOG(Error, TEXT("Invalid modifier from %s"), *Source.ToString());
+        return FSGModifierHandle();
+    }
+    
+    const FSGModifierHandle Handle = ModifierLedger.Add(Source, BonusType, SGModifiers::GetSlot(Target, SkillType), Value);
+    InvalidateChangedModifiers();
+    return Handle;
+}
+
+bool ASGCharacterBase::RemoveModifier(const FSGModifierHandle& Handle)
+{
+    const bool bRemoved = ModifierLedger.Remove(Handle);
+    InvalidateChangedModifiers();
+    return bRemoved;
+}
+
+int32 ASGCharacterBase::RemoveModifiersFromSource(FName Source)
+{
+    const int32 NumRemoved = ModifierLedger.RemoveAllFromSource(Source);
+    InvalidateChangedModifiers();
+    return NumRemoved;
+}
+
+int32 ASGCharacterBase::GetModifierTotal(ESGModifierTarget Target, ESGSkillType SkillType) const
+{
+    if (Target >= ESGModifierTarget::MAX || SkillType >= ESGSkillType::MAX)
+    {
+        return 0;
+    }
+    return ModifierLedger.GetTotal(SGModifiers::GetSlot(Target, SkillType));
+}
+
+void ASGCharacterBase::InvalidateChangedModifiers()
+{
+    const uint64 ChangedSlots = ModifierLedger.ConsumeChangedSlots();
+    if (ChangedSlots == 0)
+    {
+        return;
+    }
+    
+    auto SlotChanged = [ChangedSlots](ESGModifierTarget Target)
+    {
+        return (ChangedSlots & SGModifiers::SlotBit(SGModifiers::GetSlot(Target))) != 0;
+    };
+    
+    uint64 StatMask = 0;
+    if (SlotChanged(ESGModifierTarget::ArmorClass))
+    {
+        StatMask |= SGDerivedStats::ArmorClassMask;
+    }
+    if (SlotChanged(ESGModifierTarget::Fortitude))
+    {
+        StatMask |= SGDerivedStats::Bit(ESGDerivedStat::Fortitude);
+    }
+    if (SlotChanged(ESGModifierTarget::Reflex))
+    {
+        StatMask |= SGDerivedStats::Bit(ESGDerivedStat::Reflex);
+    }
+    if (SlotChanged(ESGModifierTarget::Will))
+    {
+        StatMask |= SGDerivedStats::Bit(ESGDerivedStat::Will);
+    }
+    if (SlotChanged(ESGModifierTarget::MaxHitPoints))
+    {
+        StatMask |= SGDerivedStats::Bit(ESGDerivedStat::MaxHitPoints);
+    }
+    
+    // Skill slots are laid out in the same order as the skill derived stats
+    StatMask |= ((ChangedSlots >> SGModifiers::FirstSkillSlot) << static_cast<uint8>(ESGDerivedStat::FirstSkill)) & SGDerivedStats::SkillMask;
+    
+    InvalidateDerivedStatMask(StatMask);
+}
+
 // ======================================================================
 // Debug & Development
 // ======================================================================
 
 void ASGCharacterBase::DebugLogState(bool bForce) const
 {
-    if (!bEnableDebugLogging && !bForce)
+    // Skip building the report entirely when the category would discard it (always in shipping)
+    if ((!bEnableDebugLogging && !bForce) || !UE_LOG_ACTIVE(LogSGCharacter, Log))
     {
         return;
     }
@@ -304,14 +741,14 @@ void ASGCharacterBase::DebugLogState(bool bForce) const
     
     // Log attributes
     DebugString += TEXT("\nAttributes:\n");
-    for (const auto& Elem : Attributes)
+    for (int32 Index = 0; Index < SGAttributeCount; ++Index)
     {
-        const ESGAttributeType AttrType = Elem.Key;
-        const FSGAttributeData& Attr = Elem.Value;
+        const ESGAttributeType AttrType = static_cast<ESGAttributeType>(Index);
+        const FSGAttributeData& Attr = AttributeBlock.Values[Index];
         DebugString += FString::Printf(TEXT("  %s: %d (Mod: %+d)\n"),
             *GetAttributeName(AttrType),
             Attr.BaseValue,
-            GetAttributeModifier(AttrType));
+            Attr.Modifier);
     }
     
     // Log derived attributes
@@ -325,19 +762,19 @@ void ASGCharacterBase::DebugLogState(bool bForce) const
     if (SkillComponent)
     {
         DebugString += TEXT("\nSkills:\n");
-        const TMap<ESGSkillType, FSGSkillData>& AllSkills = SkillComponent->GetAllSkills();
+        const FSGSkillContainer& AllSkills = SkillComponent->GetSkills();
         
-        for (const auto& Elem : AllSkills)
+        for (int32 Index = 0; Index < SGSkillCount; ++Index)
         {
-            const ESGSkillType SkillType = Elem.Key;
-            const FSGSkillData& SkillData = Elem.Value;
+            const ESGSkillType SkillType = static_cast<ESGSkillType>(Index);
+            const FSGSkillData SkillData = AllSkills.GetSkill(SkillType);
             
             if (SkillData.Ranks > 0 || SkillData.ClassSkill)
             {
-                const int32 TotalBonus = SkillComponent->GetSkillBonus(SkillType);
-                const FString SkillName = USGSkillComponent::GetSkillDisplayName(SkillType);
+                const int32 TotalBonus = GetSkillTotal(SkillType);
+                const FString& SkillName = USGSkillComponent::GetSkillDisplayName(SkillType);
                 const ESGAttributeType KeyAbility = USGSkillComponent::GetKeyAbilityForSkill(SkillType);
-                const FString AbilityName = GetAttributeName(KeyAbility);
+                const FString& AbilityName = GetAttributeName(KeyAbility);
                 
                 DebugString += FString::Printf(TEXT("  %s: %+d (%s %+d + %d ranks%s)\n"),
                     *SkillName,
@@ -350,25 +787,17 @@ void ASGCharacterBase::DebugLogState(bool bForce) const
         }
     }
         
-    // Calculate AC values for display
-    const int32 DexMod = GetAttributeModifier(ESGAttributeType::DEX);
-    const int32 TotalAC = ArmorClass.CalculateTotalAC(DexMod);
-    const int32 TouchAC = ArmorClass.CalculateTouchAC(DexMod);
-    const int32 FlatFootedAC = ArmorClass.CalculateFlatFootedAC();
-    
+    // Read AC values for display
     DebugString += FString::Printf(TEXT("  AC: %d (Touch: %d, FF: %d)\n"), 
-        TotalAC,
-        TouchAC,
-        FlatFootedAC);
+        GetTotalArmorClass(),
+        GetTouchArmorClass(),
+        GetFlatFootedArmorClass());
         
-    // Calculate saving throws for display
-    const int32 ConMod = GetAttributeModifier(ESGAttributeType::CON);
-    const int32 WisMod = GetAttributeModifier(ESGAttributeType::WIS);
-    
+    // Read saving throws for display
     DebugString += FString::Printf(TEXT("  Saves - Fort: %+d, Ref: %+d, Will: %+d\n"),
-        SavingThrows.Fortitude.CalculateTotal(ConMod),
-        SavingThrows.Reflex.CalculateTotal(DexMod),
-        SavingThrows.Will.CalculateTotal(WisMod));
+        GetSavingThrowTotal(ESGSavingThrowType::Fortitude),
+        GetSavingThrowTotal(ESGSavingThrowType::Reflex),
+        GetSavingThrowTotal(ESGSavingThrowType::Will));
     
     UE_LOG(LogSGCharacter, Log, TEXT("%s"), *DebugString);
 }
@@ -383,3 +812,9 @@ void ASGCharacterBase::OnAttributeChanged(ESGAttributeType AttributeType)
     // This is called after an attribute changes and derived attributes are recalculated
     SG_LOG(Verbose, TEXT("Attribute changed: %s"), *GetAttributeName(AttributeType));
 }
+
+void ASGCharacterBase::OnAttributesCommitted(const TArray<ESGAttributeType>& ChangedAttributes)
+{
+    // Base implementation does nothing, can be overridden by derived classes
+    SG_LOG(Verbose, TEXT("Attribute transaction committed (%d attributes changed)"), ChangedAttributes.Num());
+}
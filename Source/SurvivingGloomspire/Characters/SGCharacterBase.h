@@ -6,9 +6,14 @@
 #include "GameFramework/Character.h"
 #include "SGAttributeType.h"
 #include "SGAttributeData.h"
+#include "SGAttributeBlock.h"
+#include "SGAttributeChangeSet.h"
 #include "SGHitPoints.h"
 #include "SGArmorClass.h"
 #include "SGSavingThrows.h"
+#include "SGDerivedStats.h"
+#include "SGModifierLedger.h"
+#include "SGCheckOdds.h"
 #include "SGClassComponent.h"
 #include "SGSkillComponent.h"
 #include "SGFeatComponent.h"
@@ -17,6 +22,11 @@
 // Forward declarations
 class USGAttributeSetBase;
 class USGAbilitySystemComponent;
+class ASGCharacterBase;
+struct FSGArmorClassBatch;
+
+// Delegate for when one or more attributes change, sent once per committed transaction
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnAttributesChanged, ASGCharacterBase*, Character, const TArray<ESGAttributeType>&, ChangedAttributes);
 
 /**
  * Base class for all characters in the game.
@@ -41,6 +51,13 @@ public:
     virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
     //~ End AActor Interface
     
+    //~ Begin UObject Interface
+    virtual void PostLoad() override;
+#if WITH_EDITOR
+    virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+    //~ End UObject Interface
+    
     // ======================================================================
     // Attribute Management - Public Interface
     // ======================================================================
@@ -62,8 +79,7 @@ public:
     void SetBaseAttribute(ESGAttributeType AttributeType, int32 NewValue);
 
     /**
-     * Recalculates all attribute modifiers and derived attributes.
-     * Call this after making multiple attribute changes for better performance.
+     * Recalculates all attribute modifiers and marks every derived attribute dirty.
      */
     UFUNCTION(BlueprintCallable, Category = "Character|Attributes")
     void CalculateAllModifiers();
@@ -84,6 +100,54 @@ public:
     UFUNCTION(BlueprintPure, Category = "Character|Attributes")
     int32 GetAttributeValue(ESGAttributeType AttributeType) const;
     
+    /**
+     * Gets the fixed-slot attribute block
+     * @return Reference to the attribute block, indexed by ESGAttributeType
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Character|Attributes")
+    const FSGAttributeBlock& GetAttributeBlock() const { return AttributeBlock; }
+    
+    /**
+     * Builds a map of all attributes.
+     * Kept for Blueprints written against the old map-based storage; C++ should use GetAttributeBlock().
+     * @return Map of attribute type to attribute data
+     */
+    UFUNCTION(BlueprintPure, Category = "Character|Attributes")
+    TMap<ESGAttributeType, FSGAttributeData> GetAllAttributes() const;
+    
+    /**
+     * Opens an attribute transaction. Until the matching commit, attribute, hit point and armor class
+     * changes only record what changed; derived stats are recomputed and listeners are notified once at commit.
+     * Transactions may be nested; only the outermost commit flushes.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Character|Attributes")
+    void BeginAttributeTransaction();
+    
+    /**
+     * Closes an attribute transaction opened with BeginAttributeTransaction
+     */
+    UFUNCTION(BlueprintCallable, Category = "Character|Attributes")
+    void CommitAttributeTransaction();
+    
+    /**
+     * Checks if an attribute transaction is open
+     */
+    UFUNCTION(BlueprintPure, Category = "Character|Attributes")
+    bool IsInAttributeTransaction() const { return AttributeTransactionDepth > 0; }
+    
+    /**
+     * Applies a batch of attribute, hit point and armor class changes as a single transaction
+     * @param ChangeSet The changes to apply
+     */
+    UFUNCTION(BlueprintCallable, Category = "Character|Attributes")
+    void ApplyAttributeChanges(const FSGAttributeChangeSet& ChangeSet);
+    
+    /**
+     * Called once per committed transaction with every attribute that changed
+     */
+    UPROPERTY(BlueprintAssignable, Category = "Character|Attributes")
+    FOnAttributesChanged OnAttributesChanged;
+    
     /**
      * Gets the character's hit points
      * @return Reference to the hit points structure
@@ -109,8 +173,15 @@ public:
      * Gets the base values used for derived attribute calculations
      * @return Base hit points from class and level
      */
-    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Character|Attributes")
+    UFUNCTION(BlueprintGetter, Category = "Character|Attributes")
     int32 GetBaseHitPoints() const { return BaseHitPoints; }
+    
+    /**
+     * Sets the base hit points from class and level and updates maximum hit points
+     * @param NewBaseHitPoints The new base hit points
+     */
+    UFUNCTION(BlueprintSetter, Category = "Character|Attributes")
+    void SetBaseHitPoints(int32 NewBaseHitPoints);
 
     /**
      * Helper function to get attribute display name as string.
@@ -118,18 +189,143 @@ public:
      * @return Display name as FString
      */
     UFUNCTION(BlueprintPure, Category = "Character|Attributes")
-    static FString GetAttributeName(ESGAttributeType AttributeType);
+    static const FString& GetAttributeName(ESGAttributeType AttributeType);
 
     // ======================================================================
     // Derived Attributes & Combat - Public Interface
     // ======================================================================
     
     /**
-     * Calculates all derived attributes based on current base attributes and base values
+     * Marks all derived attributes dirty so they are recomputed on their next read.
+     * Prefer InvalidateDerivedStats with a specific input when only one input changed.
      */
     UFUNCTION(BlueprintCallable, Category = "Character|Combat")
     void CalculateDerivedAttributes();
     
+    /**
+     * Marks every derived stat that depends on an input as dirty.
+     * Components and equipment code call this whenever they change something derived stats read.
+     * @param Input The input that changed
+     */
+    void InvalidateDerivedStats(ESGDerivedInput Input);
+    
+    /**
+     * Marks a single derived stat as dirty
+     * @param Stat The stat whose inputs changed
+     */
+    void InvalidateDerivedStat(ESGDerivedStat Stat);
+    
+    /**
+     * Gets a derived stat, recomputing it first only if one of its inputs changed
+     * @param Stat The stat to read
+     * @return The current value of the stat
+     */
+    int32 GetDerivedStat(ESGDerivedStat Stat) const;
+    
+    /**
+     * Gets the character's maximum hit points
+     */
+    UFUNCTION(BlueprintPure, Category = "Character|Combat")
+    int32 GetMaxHitPoints() const { return GetDerivedStat(ESGDerivedStat::MaxHitPoints); }
+    
+    /**
+     * Gets the character's total armor class
+     */
+    UFUNCTION(BlueprintPure, Category = "Character|Combat")
+    int32 GetTotalArmorClass() const { return GetDerivedStat(ESGDerivedStat::ArmorClass); }
+    
+    /**
+     * Gets the character's touch armor class
+     */
+    UFUNCTION(BlueprintPure, Category = "Character|Combat")
+    int32 GetTouchArmorClass() const { return GetDerivedStat(ESGDerivedStat::TouchArmorClass); }
+    
+    /**
+     * Gets the character's flat-footed armor class
+     */
+    UFUNCTION(BlueprintPure, Category = "Character|Combat")
+    int32 GetFlatFootedArmorClass() const { return GetDerivedStat(ESGDerivedStat::FlatFootedArmorClass); }
+    
+    /**
+     * Appends this character's armor class inputs to a batch for SGCombat::EvaluateArmorClassBatch
+     * @param Batch The batch to append to
+     * @param SizeModifier Size modifier to AC
+     * @return Index of this character in the batch
+     */
+    int32 AppendToArmorClassBatch(FSGArmorClassBatch& Batch, int32 SizeModifier = 0) const;
+    
+    /**
+     * Gets the total bonus for a saving throw
+     * @param SaveType The saving throw
+     */
+    UFUNCTION(BlueprintPure, Category = "Character|Combat")
+    int32 GetSavingThrowTotal(ESGSavingThrowType SaveType) const { return GetDerivedStat(SGDerivedStats::SaveStat(SaveType)); }
+    
+    /**
+     * Gets the total bonus for a skill
+     * @param SkillType The skill
+     */
+    UFUNCTION(BlueprintPure, Category = "Character|Skills")
+    int32 GetSkillTotal(ESGSkillType SkillType) const { return GetDerivedStat(SGDerivedStats::SkillStat(SkillType)); }
+    
+    /**
+     * Gets the exact odds of this character making a saving throw
+     * @param SaveType The saving throw
+     * @param DifficultyClass The DC to meet
+     */
+    UFUNCTION(BlueprintPure, Category = "Character|Combat")
+    FSGCheckOdds GetSavingThrowOdds(ESGSavingThrowType SaveType, int32 DifficultyClass) const;
+    
+    /**
+     * Gets the exact odds of an attack hitting this character
+     * @param AttackBonus The attacker's total attack bonus
+     * @param AgainstType Which of this character's armor classes the attack targets
+     * @param ThreatRange Lowest natural roll that threatens a critical hit
+     */
+    UFUNCTION(BlueprintPure, Category = "Character|Combat")
+    FSGCheckOdds GetOddsToBeHit(int32 AttackBonus, ESGArmorClassType AgainstType = ESGArmorClassType::Normal, int32 ThreatRange = 20) const;
+    
+    // ======================================================================
+    // Modifiers - Public Interface
+    // ======================================================================
+    
+    /**
+     * Adds a typed bonus or penalty to the character's modifier ledger
+     * @param Source What granted the modifier; used for same-source stacking and bulk removal
+     * @param BonusType Pathfinder bonus type used for stacking
+     * @param Target The stat to modify
+     * @param Value Bonus (positive) or penalty (negative)
+     * @param SkillType The skill to modify when Target is Skill
+     * @return Handle used to remove the modifier
+     */
+    UFUNCTION(BlueprintCallable, Category = "Character|Modifiers")
+    FSGModifierHandle AddModifier(FName Source, ESGBonusType BonusType, ESGModifierTarget Target, int32 Value, ESGSkillType SkillType = ESGSkillType::Acrobatics);
+    
+    /**
+     * Removes a modifier added with AddModifier
+     * @return True if the modifier was active
+     */
+    UFUNCTION(BlueprintCallable, Category = "Character|Modifiers")
+    bool RemoveModifier(const FSGModifierHandle& Handle);
+    
+    /**
+     * Removes every modifier granted by a source
+     * @return Number of modifiers removed
+     */
+    UFUNCTION(BlueprintCallable, Category = "Character|Modifiers")
+    int32 RemoveModifiersFromSource(FName Source);
+    
+    /**
+     * Gets the stacked total of every modifier on a stat
+     * @param Target The stat
+     * @param SkillType The skill when Target is Skill
+     */
+    UFUNCTION(BlueprintPure, Category = "Character|Modifiers")
+    int32 GetModifierTotal(ESGModifierTarget Target, ESGSkillType SkillType = ESGSkillType::Acrobatics) const;
+    
+    /** Gets the character's modifier ledger */
+    const FSGModifierLedger& GetModifierLedger() const { return ModifierLedger; }
+    
     /**
      * Applies damage to the character, reducing hit points
      * @param Amount Amount of damage to apply
@@ -145,6 +341,24 @@ public:
      */
     UFUNCTION(BlueprintCallable, Category = "Character|Combat")
     int32 ApplyHealing(int32 Amount);
+    
+    /**
+     * Applies several damage and healing changes in order as one update.
+     * Used by USGDamageQueueSubsystem to resolve a frame's worth of hits on this character at once.
+     * @param Changes The changes to apply
+     * @return Hit points before the changes were applied
+     */
+    FSGHitPoints ApplyHitPointChanges(TConstArrayView<FSGHitPointChange> Changes);
+    
+    /** Checks if the character is at 0 or fewer hit points */
+    UFUNCTION(BlueprintPure, Category = "Character|Combat")
+    bool IsDefeated() const { return HitPoints.Current <= 0; }
+
+    /** Gets the identifier USGDiceSubsystem keys this character's dice streams by, or 0 before the first roll */
+    uint32 GetDiceRollerId() const { return DiceRollerId; }
+
+    /** Sets the dice roller identifier; assigned by USGDiceSubsystem on the character's first roll */
+    void SetDiceRollerId(uint32 NewRollerId) { DiceRollerId = NewRollerId; }
 
     // ======================================================================
     // Class & Progression - Public Interface
@@ -195,9 +409,15 @@ protected:
     // Core Character Properties
     // ======================================================================
     
-    /** Map of all character attributes */
+    /** All character attributes, indexed by ESGAttributeType */
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Character|Attributes")
-    TMap<ESGAttributeType, FSGAttributeData> Attributes;
+    FSGAttributeBlock AttributeBlock;
+
+#if WITH_EDITORONLY_DATA
+    /** Legacy map-based attribute storage, migrated into AttributeBlock on load */
+    UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Use AttributeBlock instead."))
+    TMap<ESGAttributeType, FSGAttributeData> Attributes_DEPRECATED;
+#endif
 
     /** Character's hit points */
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Character|Attributes")
@@ -211,8 +431,8 @@ protected:
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Character|Attributes")
     FSGSavingThrows SavingThrows;
     
-    /** Base hit points from class and level */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Character|Attributes")
+    /** Base hit points from class and level; Blueprint writes go through SetBaseHitPoints so maximum hit points follow */
+    UPROPERTY(EditAnywhere, BlueprintGetter = GetBaseHitPoints, BlueprintSetter = SetBaseHitPoints, Category = "Character|Attributes")
     int32 BaseHitPoints = 10;
 
     // ======================================================================
@@ -222,9 +442,24 @@ protected:
     /** Initializes default attribute values */
     virtual void InitializeDefaultAttributes();
     
-    /** Called when an attribute changes value */
+    /** Called when an attribute changes value outside of a transaction */
     virtual void OnAttributeChanged(ESGAttributeType AttributeType);
     
+    /**
+     * Called once when a transaction commits, after derived attributes are up to date
+     * @param ChangedAttributes Every attribute whose value changed (may be empty if only HP or AC changed)
+     */
+    virtual void OnAttributesCommitted(const TArray<ESGAttributeType>& ChangedAttributes);
+    
+    /** Computes the current value of a single derived stat from its inputs */
+    int32 ComputeDerivedStat(ESGDerivedStat Stat) const;
+    
+    /** Resolves maximum hit points and clamps current hit points to it */
+    void RefreshHitPoints();
+    
+    /** Combines the armor class fields with the Armor, Shield, Natural Armor, Deflection and Dodge entries in the ledger */
+    FSGArmorClass GetEffectiveArmorClass(int32& OutOtherModifiers) const;
+    
 private:
     // ======================================================================
     // Components
@@ -246,7 +481,69 @@ private:
     // Private Properties
     // ======================================================================
     
-    /** Controls whether debug logging is enabled for this character */
+    /** Identifier of this character's dice streams; saved so rolls continue the same streams after a load */
+    UPROPERTY(VisibleInstanceOnly, SaveGame, DuplicateTransient, Category = "Character|Combat")
+    uint32 DiceRollerId = 0;
+
+    /** Controls whether debug logging is enabled for this character (Verbose lines also need LogSGCharacter at Verbose) */
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Debug", meta = (AllowPrivateAccess = "true"))
-    bool bEnableDebugLogging = true;
+    bool bEnableDebugLogging = false;
+    
+    /** Lazily recomputed derived stats and their dirty flags */
+    mutable FSGDerivedStats DerivedStats;
+    
+    /** Typed bonuses and penalties from feats, class features, spells and items */
+    FSGModifierLedger ModifierLedger;
+    
+    /** Nesting depth of open attribute transactions */
+    int32 AttributeTransactionDepth = 0;
+    
+    /** Bit per ESGAttributeType changed during the open transaction */
+    uint8 PendingChangedAttributes = 0;
+    
+    /** Whether anything changed during the open transaction */
+    bool bTransactionHasChanges = false;
+    
+    /** Notifies listeners about a set of changed attributes */
+    void BroadcastAttributesChanged(uint8 ChangedAttributeMask);
+    
+    /** Invalidates the derived stats fed by ledger slots whose totals changed */
+    void InvalidateChangedModifiers();
+    
+    /** Marks a set of derived stats dirty, forwarding skill totals to the skill component */
+    void InvalidateDerivedStatMask(uint64 StatMask);
+    
+    /** Recomputes everything read from class progression once the class assets have loaded */
+    UFUNCTION()
+    void HandleClassesLoaded(int32 NumClasses);
+};
+
+/**
+ * Scoped attribute transaction for C++ callers.
+ * Opens a transaction on construction and commits it when it goes out of scope.
+ */
+class FSGScopedAttributeTransaction
+{
+public:
+    explicit FSGScopedAttributeTransaction(ASGCharacterBase* InCharacter)
+        : Character(InCharacter)
+    {
+        if (Character)
+        {
+            Character->BeginAttributeTransaction();
+        }
+    }
+
+    ~FSGScopedAttributeTransaction()
+    {
+        if (Character)
+        {
+            Character->CommitAttributeTransaction();
+        }
+    }
+
+    UE_NONCOPYABLE(FSGScopedAttributeTransaction);
+
+private:
+    ASGCharacterBase* Character;
 };
@@ -0,0 +1,25 @@
+// Copyright 2025 Surviving Gloomspire Team. All Rights Reserved.
+
+#include "SGCompileDiagnostics.h"
+
+#define LOCTEXT_NAMESPACE "SGCompileDiagnostics"
+
+void FSGCompileDiagnostics::AddError(FText&& Error)
+{
+    bAllCompiled = false;
+    if (!Errors)
+    {
+        return;
+    }
+
+    if (Subject.IsEmpty())
+    {
+        Errors->Add(MoveTemp(Error));
+    }
+    else
+    {
+        Errors->Add(FText::Format(LOCTEXT("SubjectError", "{0}: {1}"), Subject, Error));
+    }
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,33 @@
+// Copyright 2025 Surviving Gloomspire Team. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Error sink shared by the data compilers (feat prerequisites, feat benefits, class features).
+ * Tracks whether anything failed and, if the caller asked for them, collects the messages.
+ */
+struct SURVIVINGGLOOMSPIRE_API FSGCompileDiagnostics
+{
+    /**
+     * @param InErrors Receives error messages; may be null when only success matters
+     * @param InSubject Prefixed to every message, e.g. the feature being compiled; empty for none
+     */
+    explicit FSGCompileDiagnostics(TArray<FText>* InErrors, FText InSubject = FText::GetEmpty())
+        : Errors(InErrors)
+        , Subject(MoveTemp(InSubject))
+    {
+    }
+
+    /** Records a failure */
+    void AddError(FText&& Error);
+
+    /** Whether no error has been recorded */
+    bool AllCompiled() const { return bAllCompiled; }
+
+private:
+    TArray<FText>* Errors;
+    FText Subject;
+    bool bAllCompiled = true;
+};
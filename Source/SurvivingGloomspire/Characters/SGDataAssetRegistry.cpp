@@ -0,0 +1,90 @@
+// Copyright 2025 Surviving Gloomspire Team. All Rights Reserved.
+
+#include "SGDataAssetRegistry.h"
+#include "SGLog.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "HAL/PlatformTime.h"
+
+void USGDataAssetRegistry::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    LoadStartTime = FPlatformTime::Seconds();
+
+    UAssetManager* AssetManager = UAssetManager::GetIfInitialized();
+    if (!AssetManager)
+    {
+        UE_LOG(LogSGCharacter, Warning, TEXT("%s: Asset Manager is not initialized, no %s assets loaded"),
+            *GetClass()->GetName(), *GetPrimaryAssetType().ToString());
+        FinishLoading();
+        return;
+    }
+
+    TArray<FPrimaryAssetId> AssetIds;
+    AssetManager->GetPrimaryAssetIdList(GetPrimaryAssetType(), AssetIds);
+
+    LoadHandle = AssetManager->LoadPrimaryAssets(AssetIds, TArray<FName>(),
+        FStreamableDelegate::CreateUObject(this, &USGDataAssetRegistry::FinishLoading));
+
+    // Nothing to load, or everything was already resident
+    if (!LoadHandle.IsValid() || LoadHandle->HasLoadCompleted())
+    {
+        FinishLoading();
+    }
+}
+
+void USGDataAssetRegistry::Deinitialize()
+{
+    if (LoadHandle.IsValid())
+    {
+        LoadHandle->CancelHandle();
+        LoadHandle.Reset();
+    }
+
+    NumLoadedAssets = 0;
+    bLoaded = false;
+
+    Super::Deinitialize();
+}
+
+void USGDataAssetRegistry::WaitUntilLoaded()
+{
+    if (bLoaded)
+    {
+        return;
+    }
+
+    if (LoadHandle.IsValid())
+    {
+        LoadHandle->WaitUntilComplete();
+    }
+
+    FinishLoading();
+}
+
+void USGDataAssetRegistry::FinishLoading()
+{
+    if (bLoaded)
+    {
+        return;
+    }
+    bLoaded = true;
+
+    if (UAssetManager* AssetManager = UAssetManager::GetIfInitialized())
+    {
+        TArray<FPrimaryAssetId> AssetIds;
+        AssetManager->GetPrimaryAssetIdList(GetPrimaryAssetType(), AssetIds);
+
+        for (const FPrimaryAssetId& AssetId : AssetIds)
+        {
+            if (RegisterAsset(AssetId, AssetManager->GetPrimaryAssetObject(AssetId)))
+            {
+                ++NumLoadedAssets;
+            }
+        }
+    }
+
+    LoadTimeSeconds = FPlatformTime::Seconds() - LoadStartTime;
+    HandleAssetsLoaded();
+}
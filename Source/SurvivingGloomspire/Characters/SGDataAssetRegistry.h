@@ -0,0 +1,83 @@
+// Copyright 2025 Surviving Gloomspire Team. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "UObject/PrimaryAssetId.h"
+#include "SGDataAssetRegistry.generated.h"
+
+struct FStreamableHandle;
+
+/**
+ * Base for the registries that load every primary asset of one type through the Asset Manager
+ * when the game instance starts.
+ *
+ * The load is asynchronous: subclasses build their tables in RegisterAsset as each asset is handed
+ * over and announce completion from HandleAssetsLoaded. Callers check IsLoaded and subscribe to the
+ * subclass's loaded delegate rather than blocking; WaitUntilLoaded is for commandlets and tests.
+ */
+UCLASS(Abstract)
+class SURVIVINGGLOOMSPIRE_API USGDataAssetRegistry : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    //~ Begin USubsystem Interface
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    //~ End USubsystem Interface
+
+    /** Whether the initial asset load has finished */
+    UFUNCTION(BlueprintPure, Category = "Data Assets")
+    bool IsLoaded() const { return bLoaded; }
+
+    /** Blocks until the initial asset load has finished, e.g. for commandlets and automated tests */
+    void WaitUntilLoaded();
+
+    /** Gets the number of assets the subclass accepted */
+    UFUNCTION(BlueprintPure, Category = "Data Assets")
+    int32 GetNumLoadedAssets() const { return NumLoadedAssets; }
+
+    /** Gets how long the initial asset load took, in seconds */
+    UFUNCTION(BlueprintPure, Category = "Data Assets")
+    float GetLoadTimeSeconds() const { return static_cast<float>(LoadTimeSeconds); }
+
+protected:
+    /** Gets a registry subsystem for an object's game instance, or null outside a game */
+    template<typename TRegistry>
+    static TRegistry* GetRegistry(const UObject* WorldContextObject)
+    {
+        const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+        const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+        return GameInstance ? GameInstance->GetSubsystem<TRegistry>() : nullptr;
+    }
+
+    /** Gets the primary asset type this registry loads */
+    virtual FPrimaryAssetType GetPrimaryAssetType() const PURE_VIRTUAL(USGDataAssetRegistry::GetPrimaryAssetType, return FPrimaryAssetType(););
+
+    /**
+     * Adds one loaded asset to the subclass's tables
+     * @param AssetId The asset's primary asset ID
+     * @param Asset The loaded asset, or null if it failed to load
+     * @return True if the asset was accepted and counts towards GetNumLoadedAssets
+     */
+    virtual bool RegisterAsset(const FPrimaryAssetId& AssetId, UObject* Asset) PURE_VIRTUAL(USGDataAssetRegistry::RegisterAsset, return false;);
+
+    /** Called once every asset has been registered; subclasses log and broadcast from here */
+    virtual void HandleAssetsLoaded() {}
+
+private:
+    /** Called by the Asset Manager when the assets have loaded */
+    void FinishLoading();
+
+    /** Keeps the loaded assets resident */
+    TSharedPtr<FStreamableHandle> LoadHandle;
+
+    double LoadStartTime = 0.0;
+    double LoadTimeSeconds = 0.0;
+    int32 NumLoadedAssets = 0;
+    bool bLoaded = false;
+};
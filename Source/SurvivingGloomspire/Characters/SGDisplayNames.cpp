@@ -0,0 +1,173 @@
+// Copyright 2025 Surviving Gloomspire Team. All Rights Reserved.
+
+#include "SGDisplayNames.h"
+#include "Internationalization/Internationalization.h"
+
+FSGEnumDisplayName FSGDisplayNames::AttributeNames[SGAttributeCount];
+FSGEnumDisplayName FSGDisplayNames::SkillNames[SGSkillCount];
+FSGEnumDisplayName FSGDisplayNames::ClassNames[SGClassTypeCount];
+FSGEnumDisplayName FSGDisplayNames::UnknownName;
+FDelegateHandle FSGDisplayNames::CultureChangedHandle;
+bool FSGDisplayNames::bBuilt = false;
+
+namespace
+{
+    /** Fills a name table from a reflected enum's entry names and an explicit display text per value */
+    void BuildEnumNames(const UEnum* Enum, TConstArrayView<FText> DisplayTexts, FSGEnumDisplayName* OutNames)
+    {
+        for (int32 Value = 0; Value < DisplayTexts.Num(); ++Value)
+        {
+            FSGEnumDisplayName& Entry = OutNames[Value];
+            Entry.NameString = Enum ? Enum->GetNameStringByValue(Value) : FString::FromInt(Value);
+            Entry.Name = FName(*Entry.NameString);
+            Entry.DisplayText = DisplayTexts[Value];
+            Entry.DisplayString = Entry.DisplayText.ToString();
+        }
+    }
+}
+
+void FSGDisplayNames::Initialize()
+{
+    Rebuild();
+
+    if (!CultureChangedHandle.IsValid())
+    {
+        CultureChangedHandle = FInternationalization::Get().OnCultureChanged().AddStatic(&FSGDisplayNames::Rebuild);
+    }
+}
+
+void FSGDisplayNames::Shutdown()
+{
+    if (CultureChangedHandle.IsValid() && FInternationalization::IsAvailable())
+    {
+        FInternationalization::Get().OnCultureChanged().Remove(CultureChangedHandle);
+    }
+    CultureChangedHandle.Reset();
+}
+
+void FSGDisplayNames::Rebuild()
+{
+    // Display names are listed here rather than read from UMETA(DisplayName), which cooked builds strip,
+    // so every build shows the same names and they are gathered for localization
+    {
+        const FText DisplayTexts[] =
+        {
+            NSLOCTEXT("SGDisplayNames", "Attribute_STR", "Strength"),
+            NSLOCTEXT("SGDisplayNames", "Attribute_DEX", "Dexterity"),
+            NSLOCTEXT("SGDisplayNames", "Attribute_CON", "Constitution"),
+            NSLOCTEXT("SGDisplayNames", "Attribute_INT", "Intelligence"),
+            NSLOCTEXT("SGDisplayNames", "Attribute_WIS", "Wisdom"),
+            NSLOCTEXT("SGDisplayNames", "Attribute_CHA", "Charisma")
+        };
+        static_assert(UE_ARRAY_COUNT(DisplayTexts) == SGAttributeCount, "Every attribute needs a display name");
+        BuildEnumNames(StaticEnum<ESGAttributeType>(), DisplayTexts, AttributeNames);
+    }
+    {
+        const FText DisplayTexts[] =
+        {
+            NSLOCTEXT("SGDisplayNames", "Skill_Acrobatics", "Acrobatics"),
+            NSLOCTEXT("SGDisplayNames", "Skill_Climb", "Climb"),
+            NSLOCTEXT("SGDisplayNames", "Skill_EscapeArtist", "Escape Artist"),
+            NSLOCTEXT("SGDisplayNames", "Skill_Fly", "Fly"),
+            NSLOCTEXT("SGDisplayNames", "Skill_Ride", "Ride"),
+            NSLOCTEXT("SGDisplayNames", "Skill_Stealth", "Stealth"),
+            NSLOCTEXT("SGDisplayNames", "Skill_Swim", "Swim"),
+            NSLOCTEXT("SGDisplayNames", "Skill_Bluff", "Bluff"),
+            NSLOCTEXT("SGDisplayNames", "Skill_Diplomacy", "Diplomacy"),
+            NSLOCTEXT("SGDisplayNames", "Skill_Disguise", "Disguise"),
+            NSLOCTEXT("SGDisplayNames", "Skill_HandleAnimal", "Handle Animal"),
+            NSLOCTEXT("SGDisplayNames", "Skill_Intimidate", "Intimidate"),
+            NSLOCTEXT("SGDisplayNames", "Skill_Perform", "Perform"),
+            NSLOCTEXT("SGDisplayNames", "Skill_Appraise", "Appraise"),
+            NSLOCTEXT("SGDisplayNames", "Skill_Craft", "Craft"),
+            NSLOCTEXT("SGDisplayNames", "Skill_KnowledgeArcana", "Knowledge (Arcana)"),
+            NSLOCTEXT("SGDisplayNames", "Skill_KnowledgeDungeoneering", "Knowledge (Dungeoneering)"),
+            NSLOCTEXT("SGDisplayNames", "Skill_KnowledgeEngineering", "Knowledge (Engineering)"),
+            NSLOCTEXT("SGDisplayNames", "Skill_KnowledgeGeography", "Knowledge (Geography)"),
+            NSLOCTEXT("SGDisplayNames", "Skill_KnowledgeHistory", "Knowledge (History)"),
+            NSLOCTEXT("SGDisplayNames", "Skill_KnowledgeLocal", "Knowledge (Local)"),
+            NSLOCTEXT("SGDisplayNames", "Skill_KnowledgeNature", "Knowledge (Nature)"),
+            NSLOCTEXT("SGDisplayNames", "Skill_KnowledgeNobility", "Knowledge (Nobility)"),
+            NSLOCTEXT("SGDisplayNames", "Skill_KnowledgePlanes", "Knowledge (Planes)"),
+            NSLOCTEXT("SGDisplayNames", "Skill_KnowledgeReligion", "Knowledge (Religion)"),
+            NSLOCTEXT("SGDisplayNames", "Skill_Linguistics", "Linguistics"),
+            NSLOCTEXT("SGDisplayNames", "Skill_Profession", "Profession"),
+            NSLOCTEXT("SGDisplayNames", "Skill_DisableDevice", "Disable Device"),
+            NSLOCTEXT("SGDisplayNames", "Skill_Perception", "Perception"),
+            NSLOCTEXT("SGDisplayNames", "Skill_SenseMotive", "Sense Motive"),
+            NSLOCTEXT("SGDisplayNames", "Skill_SleightOfHand", "Sleight of Hand"),
+            NSLOCTEXT("SGDisplayNames", "Skill_Heal", "Heal"),
+            NSLOCTEXT("SGDisplayNames", "Skill_Spellcraft", "Spellcraft"),
+            NSLOCTEXT("SGDisplayNames", "Skill_Survival", "Survival"),
+            NSLOCTEXT("SGDisplayNames", "Skill_UseMagicDevice", "Use Magic Device")
+        };
+        static_assert(UE_ARRAY_COUNT(DisplayTexts) == SGSkillCount, "Every skill needs a display name");
+        BuildEnumNames(StaticEnum<ESGSkillType>(), DisplayTexts, SkillNames);
+    }
+    {
+        const FText DisplayTexts[] =
+        {
+            NSLOCTEXT("SGDisplayNames", "Class_None", "None"),
+            NSLOCTEXT("SGDisplayNames", "Class_Barbarian", "Barbarian"),
+            NSLOCTEXT("SGDisplayNames", "Class_Bard", "Bard"),
+            NSLOCTEXT("SGDisplayNames", "Class_Cleric", "Cleric"),
+            NSLOCTEXT("SGDisplayNames", "Class_Druid", "Druid"),
+            NSLOCTEXT("SGDisplayNames", "Class_Fighter", "Fighter"),
+            NSLOCTEXT("SGDisplayNames", "Class_Monk", "Monk"),
+            NSLOCTEXT("SGDisplayNames", "Class_Paladin", "Paladin"),
+            NSLOCTEXT("SGDisplayNames", "Class_Ranger", "Ranger"),
+            NSLOCTEXT("SGDisplayNames", "Class_Rogue", "Rogue"),
+            NSLOCTEXT("SGDisplayNames", "Class_Sorcerer", "Sorcerer"),
+            NSLOCTEXT("SGDisplayNames", "Class_Wizard", "Wizard")
+        };
+        static_assert(UE_ARRAY_COUNT(DisplayTexts) == SGClassTypeCount, "Every class needs a display name");
+        BuildEnumNames(StaticEnum<ESGClassType>(), DisplayTexts, ClassNames);
+    }
+
+    UnknownName.Name = FName(TEXT("Unknown"));
+    UnknownName.NameString = TEXT("Unknown");
+    UnknownName.DisplayText = NSLOCTEXT("SGDisplayNames", "Unknown", "Unknown");
+    UnknownName.DisplayString = UnknownName.DisplayText.ToString();
+
+    bBuilt = true;
+}
+
+const FSGEnumDisplayName& FSGDisplayNames::GetAttribute(ESGAttributeType AttributeType)
+{
+    EnsureBuilt();
+    const uint8 Index = static_cast<uint8>(AttributeType);
+    return Index < SGAttributeCount ? AttributeNames[Index] : UnknownName;
+}
+
+const FSGEnumDisplayName& FSGDisplayNames::GetSkill(ESGSkillType SkillType)
+{
+    EnsureBuilt();
+    const uint8 Index = static_cast<uint8>(SkillType);
+    return Index < SGSkillCount ? SkillNames[Index] : UnknownName;
+}
+
+const FSGEnumDisplayName& FSGDisplayNames::GetClass(ESGClassType ClassType)
+{
+    EnsureBuilt();
+    const uint8 Index = static_cast<uint8>(ClassType);
+    return Index < SGClassTypeCount ? ClassNames[Index] : UnknownName;
+}
+
+// ======================================================================
+// Enum Helpers
+// ======================================================================
+
+const FString& GetAttributeTypeAsString(ESGAttributeType AttributeType)
+{
+    return FSGDisplayNames::GetAttribute(AttributeType).NameString;
+}
+
+const FString& GetSkillName(ESGSkillType SkillType)
+{
+    return FSGDisplayNames::GetSkill(SkillType).DisplayString;
+}
+
+const FString& GetClassTypeAsString(ESGClassType ClassType)
+{
+    return FSGDisplayNames::GetClass(ClassType).NameString;
+}
@@ -0,0 +1,70 @@
+// Copyright 2025 Surviving Gloomspire Team. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SGAttributeType.h"
+#include "SGSkillType.h"
+#include "SGClassType.h"
+
+/**
+ * Precomputed names for a single enum value
+ */
+struct FSGEnumDisplayName
+{
+    /** Authored enum entry name (e.g., "KnowledgeArcana") */
+    FName Name;
+
+    /** Authored enum entry name as a string */
+    FString NameString;
+
+    /** Localized display name (e.g., "Knowledge (Arcana)") */
+    FText DisplayText;
+
+    /** Localized display name as a string */
+    FString DisplayString;
+};
+
+/**
+ * Module-level registry of attribute, skill and class names.
+ * Built once when the module starts and rebuilt whenever the culture changes, so name lookups
+ * are array reads instead of UEnum searches and string formatting. Game thread only.
+ */
+class SURVIVINGGLOOMSPIRE_API FSGDisplayNames
+{
+public:
+    /** Builds every name table and starts listening for culture changes */
+    static void Initialize();
+
+    /** Stops listening for culture changes */
+    static void Shutdown();
+
+    /** Gets the names for an attribute */
+    static const FSGEnumDisplayName& GetAttribute(ESGAttributeType AttributeType);
+
+    /** Gets the names for a skill */
+    static const FSGEnumDisplayName& GetSkill(ESGSkillType SkillType);
+
+    /** Gets the names for a class */
+    static const FSGEnumDisplayName& GetClass(ESGClassType ClassType);
+
+private:
+    /** Rebuilds every name table from the enum entry names and the explicit display texts */
+    static void Rebuild();
+
+    /** Builds the tables on first use if the module has not started yet (e.g., during CDO construction) */
+    FORCEINLINE static void EnsureBuilt()
+    {
+        if (UNLIKELY(!bBuilt))
+        {
+            Rebuild();
+        }
+    }
+
+    static FSGEnumDisplayName AttributeNames[SGAttributeCount];
+    static FSGEnumDisplayName SkillNames[SGSkillCount];
+    static FSGEnumDisplayName ClassNames[SGClassTypeCount];
+    static FSGEnumDisplayName UnknownName;
+    static FDelegateHandle CultureChangedHandle;
+    static bool bBuilt;
+};
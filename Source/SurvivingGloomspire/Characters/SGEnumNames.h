@@ -0,0 +1,65 @@
+// Copyright 2025 Surviving Gloomspire Team. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Invoke.h"
+#include "UObject/Class.h"
+
+/**
+ * Resolves authored names (asset fields, data keys) to enum values for the data compilers.
+ *
+ * Entry names are matched first because every build keeps them. UMETA(DisplayName) is editor-only
+ * metadata, so display-name aliases come from a caller-supplied getter, usually an FSGDisplayNames table.
+ */
+namespace SGEnumNames
+{
+    /**
+     * Matches a name against an enum's entry names, ignoring case
+     * @param Name The authored name
+     * @param NumValues How many leading entries can match, which excludes MAX and other sentinels
+     * @param OutValue Receives the matched value
+     */
+    template<typename TEnum>
+    bool Resolve(FStringView Name, int32 NumValues, TEnum& OutValue)
+    {
+        const UEnum* Enum = StaticEnum<TEnum>();
+        for (int32 Index = 0; Index < NumValues; ++Index)
+        {
+            if (Name.Equals(Enum->GetNameStringByIndex(Index), ESearchCase::IgnoreCase))
+            {
+                OutValue = static_cast<TEnum>(Enum->GetValueByIndex(Index));
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Matches a name against an enum's entry names, then against the source (unlocalized) string of each
+     * value's display text, e.g. "Knowledge (Arcana)"
+     * @param Name The authored name
+     * @param NumValues How many leading entries can match, which excludes MAX and other sentinels
+     * @param GetDisplayText Callable taking a TEnum and returning its FText display name
+     * @param OutValue Receives the matched value
+     */
+    template<typename TEnum, typename TGetDisplayText>
+    bool Resolve(FStringView Name, int32 NumValues, TGetDisplayText&& GetDisplayText, TEnum& OutValue)
+    {
+        if (Resolve(Name, NumValues, OutValue))
+        {
+            return true;
+        }
+
+        for (int32 Index = 0; Index < NumValues; ++Index)
+        {
+            const TEnum Value = static_cast<TEnum>(Index);
+            if (Name.Equals(Invoke(GetDisplayText, Value).BuildSourceString(), ESearchCase::IgnoreCase))
+            {
+                OutValue = Value;
+                return true;
+            }
+        }
+        return false;
+    }
+}
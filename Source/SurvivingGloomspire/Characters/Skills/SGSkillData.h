@@ -4,10 +4,40 @@
 
 #include "CoreMinimal.h"
 #include "SGSkillType.h"
+#include "SGRulesTables.h"
 #include "SGSkillData.generated.h"
 
+namespace SGSkills
+{
+    constexpr uint64 Bit(ESGSkillType SkillType)
+    {
+        return uint64(1) << static_cast<uint8>(SkillType);
+    }
+
+    /** Every skill */
+    constexpr uint64 AllSkillsMask = (uint64(1) << SGSkillCount) - 1;
+
+    /** Skills that take the armor check penalty (every STR- and DEX-based skill) */
+    constexpr uint64 ArmorCheckPenaltyMask = []()
+    {
+        uint64 Mask = 0;
+        for (int32 Index = 0; Index < SGSkillCount; ++Index)
+        {
+            const ESGAttributeType KeyAbility = SGRules::SkillKeyAbilityTable[Index];
+            if (KeyAbility == ESGAttributeType::STR || KeyAbility == ESGAttributeType::DEX)
+            {
+                Mask |= uint64(1) << Index;
+            }
+        }
+        return Mask;
+    }();
+
+    static_assert(SGSkillCount <= 64, "Skill flags must fit in a uint64");
+}
+
 /**
- * Represents the data for a single skill
+ * Represents the data for a single skill.
+ * Skills are stored packed in FSGSkillContainer; this is a by-value view of one of them.
  */
 USTRUCT(BlueprintType)
 struct FSGSkillData
@@ -19,7 +49,7 @@ struct FSGSkillData
         : Ranks(0)
         , ClassSkill(false)
         , TrainedOnly(false)
-        , ArmorCheckPenalty(0.0f)
+        , ArmorCheckPenalty(0)
     {
     }
 
@@ -27,7 +57,7 @@ struct FSGSkillData
         : Ranks(0)
         , ClassSkill(bIsClassSkill)
         , TrainedOnly(bIsTrainedOnly)
-        , ArmorCheckPenalty(0.0f)
+        , ArmorCheckPenalty(0)
     {
     }
 
@@ -43,9 +73,9 @@ struct FSGSkillData
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skill")
     bool TrainedOnly;
 
-    /** Armor check penalty to apply to this skill */
+    /** Armor check penalty to apply to this skill (zero or negative) */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skill")
-    float ArmorCheckPenalty;
+    int32 ArmorCheckPenalty;
 
     /**
      * Calculate the total bonus for this skill
@@ -56,16 +86,16 @@ struct FSGSkillData
     int32 CalculateTotalBonus(int32 AbilityModifier, int32 MiscModifier = 0) const
     {
         int32 Total = Ranks + AbilityModifier + MiscModifier;
-        
+
         // Apply class skill bonus if applicable
         if (ClassSkill && Ranks > 0)
         {
             Total += 3; // +3 bonus for class skills with at least 1 rank
         }
-        
+
         // Apply armor check penalty
-        Total += FMath::FloorToInt(ArmorCheckPenalty);
-        
+        Total += ArmorCheckPenalty;
+
         return Total;
     }
 
@@ -79,34 +109,113 @@ struct FSGSkillData
 };
 
 /**
- * Map of skill type to skill data
+ * Packed storage for all of a character's skills.
+ * Ranks are a fixed array indexed by ESGSkillType and the per-skill flags are bitsets,
+ * so every lookup is constant time and the whole container is a few dozen bytes.
  */
 USTRUCT(BlueprintType)
 struct FSGSkillContainer
 {
     GENERATED_BODY()
 
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skills")
-    TMap<ESGSkillType, FSGSkillData> Skills;
+    FSGSkillContainer()
+        : ClassSkillMask(0)
+        , TrainedOnlyMask(0)
+        , ArmorCheckPenalty(0)
+    {
+        FMemory::Memzero(Ranks);
+    }
+
+    /** Ranks in each skill, indexed by ESGSkillType */
+    UPROPERTY(EditAnywhere, Category = "Skills", meta = (ArraySizeEnum = "ESGSkillType"))
+    uint8 Ranks[SGSkillCount];
+
+    /** Bit per ESGSkillType that is a class skill */
+    UPROPERTY(EditAnywhere, Category = "Skills")
+    uint64 ClassSkillMask;
+
+    /** Bit per ESGSkillType that can only be used with at least 1 rank */
+    UPROPERTY(EditAnywhere, Category = "Skills")
+    uint64 TrainedOnlyMask;
+
+    /** Armor check penalty from worn armor and shields, applied to every STR- and DEX-based skill */
+    UPROPERTY(EditAnywhere, Category = "Skills", meta = (ClampMax = "0"))
+    int32 ArmorCheckPenalty;
+
+#if WITH_EDITORONLY_DATA
+    /** Legacy map-based skill storage, migrated into the packed fields on load */
+    UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Use the packed skill fields instead."))
+    TMap<ESGSkillType, FSGSkillData> Skills_DEPRECATED;
+#endif
+
+    /** Gets the ranks in a skill */
+    FORCEINLINE int32 GetRanks(ESGSkillType SkillType) const
+    {
+        checkSlow(SkillType < ESGSkillType::MAX);
+        return Ranks[static_cast<uint8>(SkillType)];
+    }
 
     /**
-     * Get a skill by type, creating it if it doesn't exist
+     * Sets the ranks in a skill
+     * @param NewRanks New rank count, clamped to 0-255
+     * @return True if the stored value changed
      */
-    FSGSkillData& GetOrAddSkill(ESGSkillType SkillType, bool bIsClassSkill = false, bool bIsTrainedOnly = false)
+    bool SetRanks(ESGSkillType SkillType, int32 NewRanks)
     {
-        if (!Skills.Contains(SkillType))
+        checkSlow(SkillType < ESGSkillType::MAX);
+        const uint8 ClampedRanks = static_cast<uint8>(FMath::Clamp(NewRanks, 0, static_cast<int32>(MAX_uint8)));
+        uint8& StoredRanks = Ranks[static_cast<uint8>(SkillType)];
+        if (StoredRanks == ClampedRanks)
         {
-            Skills.Add(SkillType, FSGSkillData(bIsClassSkill, bIsTrainedOnly));
+            return false;
         }
-        return Skills[SkillType];
+        StoredRanks = ClampedRanks;
+        return true;
+    }
+
+    FORCEINLINE bool IsClassSkill(ESGSkillType SkillType) const
+    {
+        return (ClassSkillMask & SGSkills::Bit(SkillType)) != 0;
+    }
+
+    void SetClassSkill(ESGSkillType SkillType, bool bIsClassSkill)
+    {
+        ClassSkillMask = bIsClassSkill ? (ClassSkillMask | SGSkills::Bit(SkillType)) : (ClassSkillMask & ~SGSkills::Bit(SkillType));
+    }
+
+    FORCEINLINE bool IsTrainedOnly(ESGSkillType SkillType) const
+    {
+        return (TrainedOnlyMask & SGSkills::Bit(SkillType)) != 0;
+    }
+
+    void SetTrainedOnly(ESGSkillType SkillType, bool bIsTrainedOnly)
+    {
+        TrainedOnlyMask = bIsTrainedOnly ? (TrainedOnlyMask | SGSkills::Bit(SkillType)) : (TrainedOnlyMask & ~SGSkills::Bit(SkillType));
+    }
+
+    /** Gets the armor check penalty that applies to a skill */
+    FORCEINLINE int32 GetArmorCheckPenalty(ESGSkillType SkillType) const
+    {
+        return (SGSkills::ArmorCheckPenaltyMask & SGSkills::Bit(SkillType)) ? ArmorCheckPenalty : 0;
+    }
+
+    /**
+     * Gets a skill as a by-value view
+     */
+    FSGSkillData GetSkill(ESGSkillType SkillType) const
+    {
+        FSGSkillData SkillData(IsClassSkill(SkillType), IsTrainedOnly(SkillType));
+        SkillData.Ranks = GetRanks(SkillType);
+        SkillData.ArmorCheckPenalty = GetArmorCheckPenalty(SkillType);
+        return SkillData;
     }
 
     /**
-     * Get a skill by type (const version)
+     * Check if a skill can be used based on training requirements
      */
-    const FSGSkillData* GetSkill(ESGSkillType SkillType) const
+    FORCEINLINE bool CanUseSkill(ESGSkillType SkillType) const
     {
-        return Skills.Find(SkillType);
+        return !IsTrainedOnly(SkillType) || GetRanks(SkillType) > 0;
     }
 
     /**
@@ -114,7 +223,36 @@ struct FSGSkillContainer
      */
     int32 GetSkillBonus(ESGSkillType SkillType, int32 AbilityModifier, int32 MiscModifier = 0) const
     {
-        const FSGSkillData* SkillData = GetSkill(SkillType);
-        return SkillData ? SkillData->CalculateTotalBonus(AbilityModifier, MiscModifier) : 0;
+        return GetSkill(SkillType).CalculateTotalBonus(AbilityModifier, MiscModifier);
     }
+
+    /** Migrates data saved with the legacy map-based layout */
+    void PostSerialize(const FArchive& Ar)
+    {
+#if WITH_EDITORONLY_DATA
+        if (Ar.IsLoading() && Skills_DEPRECATED.Num() > 0)
+        {
+            for (const TPair<ESGSkillType, FSGSkillData>& Elem : Skills_DEPRECATED)
+            {
+                if (Elem.Key < ESGSkillType::MAX)
+                {
+                    SetRanks(Elem.Key, Elem.Value.Ranks);
+                    SetClassSkill(Elem.Key, Elem.Value.ClassSkill);
+                    SetTrainedOnly(Elem.Key, Elem.Value.TrainedOnly);
+                    ArmorCheckPenalty = FMath::Min(ArmorCheckPenalty, Elem.Value.ArmorCheckPenalty);
+                }
+            }
+            Skills_DEPRECATED.Empty();
+        }
+#endif
+    }
+};
+
+template<>
+struct TStructOpsTypeTraits<FSGSkillContainer> : public TStructOpsTypeTraitsBase2<FSGSkillContainer>
+{
+    enum
+    {
+        WithPostSerialize = true,
+    };
 };
@@ -14,138 +14,56 @@ UENUM(BlueprintType)
 enum class ESGSkillType : uint8
 {
     // Physical Skills
-    Acrobatics,
-    Climb,
-    EscapeArtist,
-    Fly,
-    Ride,
-    Stealth,
-    Swim,
+    Acrobatics             UMETA(DisplayName = "Acrobatics"),
+    Climb                  UMETA(DisplayName = "Climb"),
+    EscapeArtist           UMETA(DisplayName = "Escape Artist"),
+    Fly                    UMETA(DisplayName = "Fly"),
+    Ride                   UMETA(DisplayName = "Ride"),
+    Stealth                UMETA(DisplayName = "Stealth"),
+    Swim                   UMETA(DisplayName = "Swim"),
     
     // Social Skills
-    Bluff,
-    Diplomacy,
-    Disguise,
-    HandleAnimal,
-    Intimidate,
-    Perform,
+    Bluff                  UMETA(DisplayName = "Bluff"),
+    Diplomacy              UMETA(DisplayName = "Diplomacy"),
+    Disguise               UMETA(DisplayName = "Disguise"),
+    HandleAnimal           UMETA(DisplayName = "Handle Animal"),
+    Intimidate             UMETA(DisplayName = "Intimidate"),
+    Perform                UMETA(DisplayName = "Perform"),
     
     // Knowledge Skills
-    Appraise,
-    Craft,
-    KnowledgeArcana,
-    KnowledgeDungeoneering,
-    KnowledgeEngineering,
-    KnowledgeGeography,
-    KnowledgeHistory,
-    KnowledgeLocal,
-    KnowledgeNature,
-    KnowledgeNobility,
-    KnowledgePlanes,
-    KnowledgeReligion,
-    Linguistics,
-    Profession,
+    Appraise               UMETA(DisplayName = "Appraise"),
+    Craft                  UMETA(DisplayName = "Craft"),
+    KnowledgeArcana        UMETA(DisplayName = "Knowledge (Arcana)"),
+    KnowledgeDungeoneering UMETA(DisplayName = "Knowledge (Dungeoneering)"),
+    KnowledgeEngineering   UMETA(DisplayName = "Knowledge (Engineering)"),
+    KnowledgeGeography     UMETA(DisplayName = "Knowledge (Geography)"),
+    KnowledgeHistory       UMETA(DisplayName = "Knowledge (History)"),
+    KnowledgeLocal         UMETA(DisplayName = "Knowledge (Local)"),
+    KnowledgeNature        UMETA(DisplayName = "Knowledge (Nature)"),
+    KnowledgeNobility      UMETA(DisplayName = "Knowledge (Nobility)"),
+    KnowledgePlanes        UMETA(DisplayName = "Knowledge (Planes)"),
+    KnowledgeReligion      UMETA(DisplayName = "Knowledge (Religion)"),
+    Linguistics            UMETA(DisplayName = "Linguistics"),
+    Profession             UMETA(DisplayName = "Profession"),
     
     // Perception Skills
-    DisableDevice,
-    Perception,
-    SenseMotive,
-    SleightOfHand,
+    DisableDevice          UMETA(DisplayName = "Disable Device"),
+    Perception             UMETA(DisplayName = "Perception"),
+    SenseMotive            UMETA(DisplayName = "Sense Motive"),
+    SleightOfHand          UMETA(DisplayName = "Sleight of Hand"),
     
     // Other Skills
-    Heal,
-    Spellcraft,
-    Survival,
-    UseMagicDevice,
+    Heal                   UMETA(DisplayName = "Heal"),
+    Spellcraft             UMETA(DisplayName = "Spellcraft"),
+    Survival               UMETA(DisplayName = "Survival"),
+    UseMagicDevice         UMETA(DisplayName = "Use Magic Device"),
     
     // Add MAX at the end for iteration
     MAX UMETA(Hidden)
 };
 
-// Helper function to get skill name as string
-static FString GetSkillName(ESGSkillType SkillType)
-{
-    const UEnum* EnumPtr = FindObject<UEnum>(nullptr, TEXT("/Script/SurvivingGloomspire.ESGSkillType"), true);
-    if (!EnumPtr) return FString("Unknown");
-    
-    // Convert enum to display name (e.g., "KnowledgeArcana" -> "Knowledge (Arcana)")
-    FString DisplayName = EnumPtr->GetNameStringByValue(static_cast<int64>(SkillType));
-    
-    // Add spaces before capital letters and handle special cases
-    DisplayName = DisplayName.Replace(TEXT("Knowledge"), TEXT("Knowledge ("), ESearchCase::CaseSensitive);
-    DisplayName = DisplayName.Replace(TEXT("Arcana"), TEXT("Arcana)"), ESearchCase::CaseSensitive);
-    DisplayName = DisplayName.Replace(TEXT("Dungeoneering"), TEXT("Dungeoneering)"), ESearchCase::CaseSensitive);
-    // Add more knowledge skills as needed...
-    
-    return DisplayName;
-}
+/** Number of skills, used to size enum-indexed skill arrays */
+constexpr int32 SGSkillCount = static_cast<int32>(ESGSkillType::MAX);
 
-// Helper function to get skill's key ability
-static ESGAttributeType GetSkillKeyAbility(ESGSkillType SkillType)
-{
-    // Default to Intelligence for knowledge skills
-    if (SkillType >= ESGSkillType::KnowledgeArcana && 
-        SkillType <= ESGSkillType::KnowledgeReligion)
-    {
-        return ESGAttributeType::INT;
-    }
-    
-    // Other skill to ability mappings
-    switch (SkillType)
-    {
-        // Strength-based skills
-        case ESGSkillType::Climb:
-        case ESGSkillType::Swim:
-            return ESGAttributeType::STR;
-            
-        // Dexterity-based skills
-        case ESGSkillType::Acrobatics:
-        case ESGSkillType::EscapeArtist:
-        case ESGSkillType::Fly:
-        case ESGSkillType::Ride:
-        case ESGSkillType::Stealth:
-        case ESGSkillType::SleightOfHand:
-            return ESGAttributeType::DEX;
-            
-        // Constitution-based skills
-        // None in standard Pathfinder
-        
-        // Intelligence-based skills
-        case ESGSkillType::Appraise:
-        case ESGSkillType::Craft:
-        case ESGSkillType::KnowledgeArcana:
-        case ESGSkillType::KnowledgeDungeoneering:
-        case ESGSkillType::KnowledgeEngineering:
-        case ESGSkillType::KnowledgeGeography:
-        case ESGSkillType::KnowledgeHistory:
-        case ESGSkillType::KnowledgeLocal:
-        case ESGSkillType::KnowledgeNature:
-        case ESGSkillType::KnowledgeNobility:
-        case ESGSkillType::KnowledgePlanes:
-        case ESGSkillType::KnowledgeReligion:
-        case ESGSkillType::Linguistics:
-        case ESGSkillType::Spellcraft:
-            return ESGAttributeType::INT;
-            
-        // Wisdom-based skills
-        case ESGSkillType::HandleAnimal:
-        case ESGSkillType::Heal:
-        case ESGSkillType::Perception:
-        case ESGSkillType::Profession:
-        case ESGSkillType::SenseMotive:
-        case ESGSkillType::Survival:
-            return ESGAttributeType::WIS;
-            
-        // Charisma-based skills
-        case ESGSkillType::Bluff:
-        case ESGSkillType::Diplomacy:
-        case ESGSkillType::Disguise:
-        case ESGSkillType::Intimidate:
-        case ESGSkillType::Perform:
-        case ESGSkillType::UseMagicDevice:
-            return ESGAttributeType::CHA;
-            
-        default:
-            return ESGAttributeType::INT; // Default to INT for any unhandled skills
-    }
-}
+// Helper function to get skill display name as string (e.g., "Knowledge (Arcana)"), backed by FSGDisplayNames
+SURVIVINGGLOOMSPIRE_API const FString& GetSkillName(ESGSkillType SkillType);
@@ -0,0 +1,8 @@
+// Copyright 2025 Surviving Gloomspire Team. All Rights Reserved.
+
+#include "SGLog.h"
+
+DEFINE_LOG_CATEGORY(LogSGCharacter);
+DEFINE_LOG_CATEGORY(LogSGSkills);
+DEFINE_LOG_CATEGORY(LogSGFeats);
+DEFINE_LOG_CATEGORY(LogSGClasses);
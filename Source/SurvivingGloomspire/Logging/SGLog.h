@@ -0,0 +1,29 @@
+// Copyright 2025 Surviving Gloomspire Team. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Logging/LogMacros.h"
+
+/**
+ * Compile-time verbosity ceiling for the character subsystem log categories.
+ * Shipping builds compile out everything below Warning, so the format arguments of
+ * Log/Verbose lines are never evaluated there.
+ */
+#if UE_BUILD_SHIPPING
+    #define SG_LOG_COMPILE_VERBOSITY Warning
+#else
+    #define SG_LOG_COMPILE_VERBOSITY All
+#endif
+
+/** Character attributes, derived stats and combat */
+SURVIVINGGLOOMSPIRE_API DECLARE_LOG_CATEGORY_EXTERN(LogSGCharacter, Log, SG_LOG_COMPILE_VERBOSITY);
+
+/** Skill ranks and skill checks */
+SURVIVINGGLOOMSPIRE_API DECLARE_LOG_CATEGORY_EXTERN(LogSGSkills, Log, SG_LOG_COMPILE_VERBOSITY);
+
+/** Feat ownership and feat data */
+SURVIVINGGLOOMSPIRE_API DECLARE_LOG_CATEGORY_EXTERN(LogSGFeats, Log, SG_LOG_COMPILE_VERBOSITY);
+
+/** Class levels, experience and class features */
+SURVIVINGGLOOMSPIRE_API DECLARE_LOG_CATEGORY_EXTERN(LogSGClasses, Log, SG_LOG_COMPILE_VERBOSITY);
@@ -0,0 +1,416 @@
+// Copyright 2025 Surviving Gloomspire Team. All Rights Reserved.
+
+#include "SGTrace.h"
+#include "SGLog.h"
+#include "SGDisplayNames.h"
+#include "SGFeatTypes.h"
+#include "Async/Mutex.h"
+#include "Async/UniqueLock.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/Event.h"
+#include "HAL/LockFreeList.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/PlatformTLS.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "Containers/Queue.h"
+#include "Misc/CommandLine.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+
+std::atomic<bool> FSGTrace::bEnabled{false};
+
+namespace
+{
+    /** Records per chunk; each chunk is 16 KB */
+    constexpr int32 RecordsPerChunk = 512;
+
+    /** Upper bound on chunks alive at once; when exhausted, threads wrap their own chunk instead of allocating */
+    constexpr int32 MaxChunks = 64;
+
+    struct FSGTraceChunk
+    {
+        /** Trace session this chunk's records belong to */
+        uint32 Generation = 0;
+
+        int32 Num = 0;
+
+        FSGTraceRecord Records[RecordsPerChunk];
+    };
+
+    /** Chunks are pooled for the life of the process so per-thread pointers never dangle across sessions */
+    TLockFreePointerListUnordered<FSGTraceChunk, PLATFORM_CACHE_LINE_SIZE> FreeChunks;
+    std::atomic<int32> AllocatedChunks{0};
+
+    /** Incremented on every Start so records from an earlier session are discarded */
+    std::atomic<uint32> TraceGeneration{0};
+
+    /** Records lost because the writer could not keep up */
+    std::atomic<int64> DroppedRecords{0};
+
+    FSGTraceChunk* AcquireChunk()
+    {
+        if (FSGTraceChunk* Chunk = FreeChunks.Pop())
+        {
+            return Chunk;
+        }
+
+        if (AllocatedChunks.fetch_add(1, std::memory_order_relaxed) < MaxChunks)
+        {
+            return new FSGTraceChunk();
+        }
+
+        AllocatedChunks.fetch_sub(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    void ReleaseChunk(FSGTraceChunk* Chunk)
+    {
+        Chunk->Num = 0;
+        FreeChunks.Push(Chunk);
+    }
+
+    /** Background thread that appends submitted chunks to the trace file */
+    class FSGTraceWriter : public FRunnable
+    {
+    public:
+        FSGTraceWriter(IFileHandle* InFileHandle, uint32 InGeneration)
+            : FileHandle(InFileHandle)
+            , Generation(InGeneration)
+        {
+            WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+            Thread = FRunnableThread::Create(this, TEXT("SGTraceWriter"), 0, TPri_BelowNormal);
+        }
+
+        virtual ~FSGTraceWriter() override
+        {
+            bStopping = true;
+            WakeEvent->Trigger();
+            if (Thread)
+            {
+                Thread->WaitForCompletion();
+                delete Thread;
+            }
+            FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+
+            // Anything submitted after the final drain belongs to this session and is written now
+            Drain();
+            delete FileHandle;
+        }
+
+        void Submit(FSGTraceChunk* Chunk)
+        {
+            PendingChunks.Enqueue(Chunk);
+            WakeEvent->Trigger();
+        }
+
+        //~ Begin FRunnable Interface
+        virtual uint32 Run() override
+        {
+            while (!bStopping)
+            {
+                WakeEvent->Wait(100);
+                Drain();
+            }
+            return 0;
+        }
+        //~ End FRunnable Interface
+
+    private:
+        void Drain()
+        {
+            FSGTraceChunk* Chunk = nullptr;
+            while (PendingChunks.Dequeue(Chunk))
+            {
+                if (Chunk->Generation == Generation && Chunk->Num > 0)
+                {
+                    FileHandle->Write(reinterpret_cast<const uint8*>(Chunk->Records), Chunk->Num * sizeof(FSGTraceRecord));
+                }
+                ReleaseChunk(Chunk);
+            }
+        }
+
+        IFileHandle* FileHandle;
+        uint32 Generation;
+        FEvent* WakeEvent = nullptr;
+        FRunnableThread* Thread = nullptr;
+        std::atomic<bool> bStopping{false};
+        TQueue<FSGTraceChunk*, EQueueMode::Mpsc> PendingChunks;
+    };
+
+    /**
+     * Active writer; only changed by Start and Stop on the game thread.
+     * Threads read it under their own state's lock, so Stop can wait out every in-flight Submit before deleting it.
+     */
+    std::atomic<FSGTraceWriter*> GWriter{nullptr};
+    FDelegateHandle EndFrameHandle;
+
+    struct FSGTraceThreadState;
+
+    /** Every thread that has recorded an event, so Stop can collect their partial chunks */
+    FCriticalSection ThreadStatesLock;
+    TArray<FSGTraceThreadState*> ThreadStates;
+
+    /** Per-thread ring of trace records */
+    struct FSGTraceThreadState
+    {
+        /** Held by the owning thread while it records and by Stop while it collects the chunk; uncontended otherwise */
+        UE::FMutex Mutex;
+
+        FSGTraceChunk* Chunk = nullptr;
+        uint32 ThreadId = FPlatformTLS::GetCurrentThreadId();
+
+        FSGTraceThreadState()
+        {
+            FScopeLock Lock(&ThreadStatesLock);
+            ThreadStates.Add(this);
+        }
+
+        ~FSGTraceThreadState()
+        {
+            // Flush while still registered so a concurrent Stop either sees this chunk or waits for the Submit
+            {
+                UE::TUniqueLock Lock(Mutex);
+                if (Chunk && Chunk->Num > 0)
+                {
+                    Submit();
+                }
+                if (Chunk)
+                {
+                    ReleaseChunk(Chunk);
+                    Chunk = nullptr;
+                }
+            }
+
+            FScopeLock Lock(&ThreadStatesLock);
+            ThreadStates.RemoveSwap(this);
+        }
+
+        /** Hands the current chunk to the writer and moves to a fresh one, or wraps if none are free; Mutex must be held */
+        void Submit()
+        {
+            FSGTraceWriter* Writer = GWriter.load(std::memory_order_acquire);
+            FSGTraceChunk* Next = Writer ? AcquireChunk() : nullptr;
+            if (Next)
+            {
+                Next->Generation = Chunk->Generation;
+                Writer->Submit(Chunk);
+                Chunk = Next;
+            }
+            else
+            {
+                DroppedRecords.fetch_add(Chunk->Num, std::memory_order_relaxed);
+                Chunk->Num = 0;
+            }
+        }
+    };
+
+    thread_local FSGTraceThreadState GThreadState;
+}
+
+void FSGTrace::Initialize()
+{
+#if SG_TRACE_ENABLED
+    if (FParse::Param(FCommandLine::Get(), TEXT("SGTrace")))
+    {
+        FString FilePath;
+        FParse::Value(FCommandLine::Get(), TEXT("SGTraceFile="), FilePath);
+        Start(FilePath);
+    }
+#endif
+}
+
+void FSGTrace::Shutdown()
+{
+    Stop();
+}
+
+void FSGTrace::Start(const FString& FilePath)
+{
+#if SG_TRACE_ENABLED
+    check(IsInGameThread());
+    Stop();
+
+    const FString OutputPath = FilePath.IsEmpty() ? FPaths::Combine(FPaths::ProjectLogDir(), TEXT("SGTrace.sgtrace")) : FilePath;
+    IFileHandle* FileHandle = FPlatformFileManager::Get().GetPlatformFile().OpenWrite(*OutputPath);
+    if (!FileHandle)
+    {
+        UE_LOG(LogSGCharacter, Warning, TEXT("SGTrace: Failed to open %s"), *OutputPath);
+        return;
+    }
+
+    FSGTraceFileHeader Header;
+    Header.SecondsPerCycle = FPlatformTime::GetSecondsPerCycle64();
+    FileHandle->Write(reinterpret_cast<const uint8*>(&Header), sizeof(Header));
+
+    const uint32 Generation = TraceGeneration.fetch_add(1, std::memory_order_relaxed) + 1;
+    DroppedRecords.store(0, std::memory_order_relaxed);
+    GWriter.store(new FSGTraceWriter(FileHandle, Generation), std::memory_order_release);
+    EndFrameHandle = FCoreDelegates::OnEndFrame.AddStatic(&FSGTrace::FlushThisThread);
+    bEnabled.store(true, std::memory_order_release);
+
+    UE_LOG(LogSGCharacter, Log, TEXT("SGTrace: Writing to %s"), *OutputPath);
+#endif
+}
+
+void FSGTrace::Stop()
+{
+    FSGTraceWriter* Writer = GWriter.exchange(nullptr, std::memory_order_acq_rel);
+    if (!Writer)
+    {
+        return;
+    }
+
+    bEnabled.store(false, std::memory_order_release);
+    FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+    EndFrameHandle.Reset();
+
+    // Collect every thread's partial chunk. Taking each thread's lock after clearing GWriter also waits for any
+    // Submit that had already read the old writer, so nothing can reach Writer once this loop finishes.
+    {
+        FScopeLock RegistryLock(&ThreadStatesLock);
+        for (FSGTraceThreadState* State : ThreadStates)
+        {
+            UE::TUniqueLock Lock(State->Mutex);
+            if (State->Chunk && State->Chunk->Num > 0)
+            {
+                Writer->Submit(State->Chunk);
+                State->Chunk = nullptr;
+            }
+        }
+    }
+
+    delete Writer;
+
+    const int64 Dropped = DroppedRecords.load(std::memory_order_relaxed);
+    if (Dropped > 0)
+    {
+        UE_LOG(LogSGCharacter, Warning, TEXT("SGTrace: %lld records were dropped because the writer fell behind"), Dropped);
+    }
+}
+
+void FSGTrace::Write(ESGTraceEvent Event, const UObject* Object, int32 Arg0, int32 Arg1, int32 Arg2)
+{
+    FSGTraceThreadState& State = GThreadState;
+    UE::TUniqueLock Lock(State.Mutex);
+    const uint32 Generation = TraceGeneration.load(std::memory_order_relaxed);
+
+    if (!State.Chunk)
+    {
+        State.Chunk = AcquireChunk();
+        if (!State.Chunk)
+        {
+            DroppedRecords.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        State.Chunk->Generation = Generation;
+    }
+    else if (State.Chunk->Generation != Generation)
+    {
+        // Left over from an earlier session
+        State.Chunk->Num = 0;
+        State.Chunk->Generation = Generation;
+    }
+
+    FSGTraceRecord& Record = State.Chunk->Records[State.Chunk->Num++];
+    Record.Cycles = FPlatformTime::Cycles64();
+    Record.ThreadId = State.ThreadId;
+    Record.ObjectId = Object ? Object->GetUniqueID() : 0;
+    Record.Event = static_cast<uint16>(Event);
+    Record.Reserved = 0;
+    Record.Args[0] = Arg0;
+    Record.Args[1] = Arg1;
+    Record.Args[2] = Arg2;
+
+    if (State.Chunk->Num == RecordsPerChunk)
+    {
+        State.Submit();
+    }
+}
+
+void FSGTrace::FlushThisThread()
+{
+    FSGTraceThreadState& State = GThreadState;
+    UE::TUniqueLock Lock(State.Mutex);
+    if (State.Chunk && State.Chunk->Num > 0)
+    {
+        State.Submit();
+    }
+}
+
+const TCHAR* FSGTrace::GetEventName(ESGTraceEvent Event)
+{
+    switch (Event)
+    {
+        case ESGTraceEvent::AttributeChanged:    return TEXT("AttributeChanged");
+        case ESGTraceEvent::AttributesCommitted: return TEXT("AttributesCommitted");
+        case ESGTraceEvent::Damage:              return TEXT("Damage");
+        case ESGTraceEvent::Healing:             return TEXT("Healing");
+        case ESGTraceEvent::SkillRanksChanged:   return TEXT("SkillRanksChanged");
+        case ESGTraceEvent::ClassSkillChanged:   return TEXT("ClassSkillChanged");
+        case ESGTraceEvent::SkillCheck:          return TEXT("SkillCheck");
+        case ESGTraceEvent::FeatAdded:           return TEXT("FeatAdded");
+        case ESGTraceEvent::FeatRemoved:         return TEXT("FeatRemoved");
+        case ESGTraceEvent::LevelUp:             return TEXT("LevelUp");
+        default:                                 return TEXT("Unknown");
+    }
+}
+
+FString FSGTrace::DescribeRecord(const FSGTraceRecord& Record)
+{
+    const int32* Args = Record.Args;
+    const ESGTraceEvent Event = static_cast<ESGTraceEvent>(Record.Event);
+
+    switch (Event)
+    {
+        case ESGTraceEvent::AttributeChanged:
+            return FString::Printf(TEXT("%s %d -> %d"),
+                *GetAttributeTypeAsString(static_cast<ESGAttributeType>(Args[0])), Args[1], Args[2]);
+
+        case ESGTraceEvent::AttributesCommitted:
+            return FString::Printf(TEXT("changed mask 0x%02x"), Args[0]);
+
+        case ESGTraceEvent::Damage:
+            return FString::Printf(TEXT("%d damage (HP: %d -> %d)"), Args[0], Args[1], Args[2]);
+
+        case ESGTraceEvent::Healing:
+            return FString::Printf(TEXT("%d healing (HP: %d -> %d)"), Args[0], Args[1], Args[2]);
+
+        case ESGTraceEvent::SkillRanksChanged:
+            return FString::Printf(TEXT("%s %+d ranks (total: %d)"),
+                *GetSkillName(static_cast<ESGSkillType>(Args[0])), Args[1], Args[2]);
+
+        case ESGTraceEvent::ClassSkillChanged:
+            return FString::Printf(TEXT("%s class skill: %s"),
+                *GetSkillName(static_cast<ESGSkillType>(Args[0])), Args[1] ? TEXT("true") : TEXT("false"));
+
+        case ESGTraceEvent::SkillCheck:
+        {
+            // Arg0 packs the skill in the low byte and the DC above it
+            const ESGSkillType SkillType = static_cast<ESGSkillType>(Args[0] & 0xFF);
+            const int32 DC = Args[0] >> 8;
+            return FString::Printf(TEXT("%s rolled %d + %d vs DC %d - %s"),
+                *GetSkillName(SkillType), Args[1], Args[2], DC, (Args[1] + Args[2]) >= DC ? TEXT("Success") : TEXT("Failure"));
+        }
+
+        case ESGTraceEvent::FeatAdded:
+        case ESGTraceEvent::FeatRemoved:
+        {
+            const UEnum* FeatEnum = StaticEnum<ESGFeatType>();
+            const FString FeatName = FeatEnum ? FeatEnum->GetNameStringByValue(Args[0]) : FString::FromInt(Args[0]);
+            return Event == ESGTraceEvent::FeatAdded
+                ? FString::Printf(TEXT("%s (stack: %d)"), *FeatName, Args[1])
+                : FeatName;
+        }
+
+        case ESGTraceEvent::LevelUp:
+            return FString::Printf(TEXT("%s, character level %d"),
+                *GetClassTypeAsString(static_cast<ESGClassType>(Args[0])), Args[1]);
+
+        default:
+            return FString::Printf(TEXT("%d %d %d"), Args[0], Args[1], Args[2]);
+    }
+}
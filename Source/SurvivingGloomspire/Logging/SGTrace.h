@@ -0,0 +1,120 @@
+// Copyright 2025 Surviving Gloomspire Team. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+/**
+ * Binary trace channel for the character subsystems.
+ * Events are written as fixed-size records into per-thread buffers with no string formatting;
+ * full buffers are handed to a background writer that appends them to Saved/Logs/SGTrace.sgtrace.
+ * Use the SGTraceDump commandlet to decode a trace file into readable text.
+ *
+ * Tracing is compiled out of shipping builds and is off at runtime unless the game is started
+ * with -SGTrace or FSGTrace::Start is called.
+ */
+#ifndef SG_TRACE_ENABLED
+    #define SG_TRACE_ENABLED (WITH_LOGGING_SYSTEM && !UE_BUILD_SHIPPING)
+#endif
+
+/** Trace event identifiers; values are written to disk, so only append new events */
+enum class ESGTraceEvent : uint16
+{
+    None = 0,
+    AttributeChanged,       // Attribute, old value, new value
+    AttributesCommitted,    // Changed attribute mask
+    Damage,                 // Amount, HP before, HP after
+    Healing,                // Amount, HP before, HP after
+    SkillRanksChanged,      // Skill, ranks added, new ranks
+    ClassSkillChanged,      // Skill, is class skill
+    SkillCheck,             // Skill | (DC << 8), roll, bonus
+    FeatAdded,              // Feat, stack count
+    FeatRemoved,            // Feat
+    LevelUp,                // Class, new character level
+
+    MAX
+};
+
+/** A single trace record as stored in memory and on disk */
+struct FSGTraceRecord
+{
+    /** FPlatformTime::Cycles64 when the event was recorded */
+    uint64 Cycles;
+
+    /** Thread that recorded the event */
+    uint32 ThreadId;
+
+    /** UObject unique ID of the subject, or 0 */
+    uint32 ObjectId;
+
+    /** ESGTraceEvent */
+    uint16 Event;
+
+    uint16 Reserved;
+
+    /** Event-specific arguments, see ESGTraceEvent */
+    int32 Args[3];
+};
+
+static_assert(sizeof(FSGTraceRecord) == 32, "Trace records are written to disk and must stay 32 bytes");
+
+/** Header at the start of every trace file */
+struct FSGTraceFileHeader
+{
+    static constexpr uint32 ExpectedMagic = 0x52544753; // 'SGTR'
+    static constexpr uint32 CurrentVersion = 1;
+
+    uint32 Magic = ExpectedMagic;
+    uint32 Version = CurrentVersion;
+
+    /** Seconds per FSGTraceRecord::Cycles tick on the recording machine */
+    double SecondsPerCycle = 0.0;
+};
+
+class SURVIVINGGLOOMSPIRE_API FSGTrace
+{
+public:
+    /** Starts tracing if -SGTrace is on the command line */
+    static void Initialize();
+
+    /** Stops tracing and flushes every pending record */
+    static void Shutdown();
+
+    /**
+     * Starts writing trace records to a file
+     * @param FilePath Output file; defaults to Saved/Logs/SGTrace.sgtrace
+     */
+    static void Start(const FString& FilePath = FString());
+
+    /** Stops tracing, collects every thread's partially filled buffer and waits for the writer to drain */
+    static void Stop();
+
+    /** Checks if tracing is running; this is the only cost of a trace point when tracing is off */
+    FORCEINLINE static bool IsEnabled()
+    {
+        return bEnabled.load(std::memory_order_relaxed);
+    }
+
+    /** Records an event on the calling thread */
+    static void Write(ESGTraceEvent Event, const UObject* Object, int32 Arg0 = 0, int32 Arg1 = 0, int32 Arg2 = 0);
+
+    /** Hands the calling thread's partially filled buffer to the writer */
+    static void FlushThisThread();
+
+    /** Gets a readable name for an event */
+    static const TCHAR* GetEventName(ESGTraceEvent Event);
+
+    /** Formats a record as readable text (used by the SGTraceDump commandlet) */
+    static FString DescribeRecord(const FSGTraceRecord& Record);
+
+private:
+    static std::atomic<bool> bEnabled;
+};
+
+#if SG_TRACE_ENABLED
+    #define SG_TRACE(Event, Object, ...) \
+        do { if (FSGTrace::IsEnabled()) { FSGTrace::Write(ESGTraceEvent::Event, Object, ##__VA_ARGS__); } } while (0)
+#else
+    #define SG_TRACE(Event, Object, ...) do { } while (0)
+#endif
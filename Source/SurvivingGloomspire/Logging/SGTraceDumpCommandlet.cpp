@@ -0,0 +1,88 @@
+// Copyright 2025 Surviving Gloomspire Team. All Rights Reserved.
+
+#include "SGTraceDumpCommandlet.h"
+#include "SGLog.h"
+#include "SGTrace.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+
+USGTraceDumpCommandlet::USGTraceDumpCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = false;
+    LogToConsole = true;
+}
+
+int32 USGTraceDumpCommandlet::Main(const FString& Params)
+{
+    FString FilePath;
+    if (!FParse::Value(*Params, TEXT("File="), FilePath))
+    {
+        FilePath = FPaths::Combine(FPaths::ProjectLogDir(), TEXT("SGTrace.sgtrace"));
+    }
+
+    TArray<uint8> Bytes;
+    if (!FFileHelper::LoadFileToArray(Bytes, *FilePath))
+    {
+        UE_LOG(LogSGCharacter, Error, TEXT("SGTraceDump: Could not read %s"), *FilePath);
+        return 1;
+    }
+
+    if (Bytes.Num() < static_cast<int32>(sizeof(FSGTraceFileHeader)))
+    {
+        UE_LOG(LogSGCharacter, Error, TEXT("SGTraceDump: %s is too small to be a trace file"), *FilePath);
+        return 1;
+    }
+
+    FSGTraceFileHeader Header;
+    FMemory::Memcpy(&Header, Bytes.GetData(), sizeof(Header));
+    if (Header.Magic != FSGTraceFileHeader::ExpectedMagic || Header.Version != FSGTraceFileHeader::CurrentVersion)
+    {
+        UE_LOG(LogSGCharacter, Error, TEXT("SGTraceDump: %s is not a version %u trace file"), *FilePath, FSGTraceFileHeader::CurrentVersion);
+        return 1;
+    }
+
+    const int32 NumRecords = (Bytes.Num() - sizeof(FSGTraceFileHeader)) / sizeof(FSGTraceRecord);
+    TArray<FSGTraceRecord> Records;
+    Records.SetNumUninitialized(NumRecords);
+    FMemory::Memcpy(Records.GetData(), Bytes.GetData() + sizeof(FSGTraceFileHeader), NumRecords * sizeof(FSGTraceRecord));
+
+    // Each thread's records arrive in chunks, so the file is only ordered per thread
+    Records.StableSort([](const FSGTraceRecord& A, const FSGTraceRecord& B) { return A.Cycles < B.Cycles; });
+
+    const uint64 FirstCycle = Records.Num() > 0 ? Records[0].Cycles : 0;
+    TArray<FString> Lines;
+    Lines.Reserve(Records.Num());
+    for (const FSGTraceRecord& Record : Records)
+    {
+        const double Seconds = static_cast<double>(Record.Cycles - FirstCycle) * Header.SecondsPerCycle;
+        Lines.Add(FString::Printf(TEXT("%12.6f  thread %-6u  object %-8u  %-20s %s"),
+            Seconds,
+            Record.ThreadId,
+            Record.ObjectId,
+            FSGTrace::GetEventName(static_cast<ESGTraceEvent>(Record.Event)),
+            *FSGTrace::DescribeRecord(Record)));
+    }
+
+    FString OutPath;
+    if (FParse::Value(*Params, TEXT("Out="), OutPath))
+    {
+        if (!FFileHelper::SaveStringArrayToFile(Lines, *OutPath))
+        {
+            UE_LOG(LogSGCharacter, Error, TEXT("SGTraceDump: Could not write %s"), *OutPath);
+            return 1;
+        }
+        UE_LOG(LogSGCharacter, Display, TEXT("SGTraceDump: Wrote %d events to %s"), Lines.Num(), *OutPath);
+    }
+    else
+    {
+        for (const FString& Line : Lines)
+        {
+            UE_LOG(LogSGCharacter, Display, TEXT("%s"), *Line);
+        }
+    }
+
+    return 0;
+}
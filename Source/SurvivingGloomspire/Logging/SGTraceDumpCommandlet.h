@@ -0,0 +1,25 @@
+// Copyright 2025 Surviving Gloomspire Team. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "SGTraceDumpCommandlet.generated.h"
+
+/**
+ * Decodes an SGTrace file into readable text, one event per line in timestamp order.
+ * Usage: -run=SGTraceDump -File=<path to .sgtrace> [-Out=<text file>]
+ * Without -Out the decoded events are written to the log.
+ */
+UCLASS()
+class SURVIVINGGLOOMSPIRE_API USGTraceDumpCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    USGTraceDumpCommandlet();
+
+    //~ Begin UCommandlet Interface
+    virtual int32 Main(const FString& Params) override;
+    //~ End UCommandlet Interface
+};
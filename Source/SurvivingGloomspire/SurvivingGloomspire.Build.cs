@@ -18,9 +18,12 @@ public class SurvivingGloomspire : ModuleRules
             Path.Combine(ModuleDirectory, "Characters"),
             Path.Combine(ModuleDirectory, "Characters/Attributes"),
             Path.Combine(ModuleDirectory, "Characters/Classes"),
+            Path.Combine(ModuleDirectory, "Characters/Combat"),
             Path.Combine(ModuleDirectory, "Characters/Components"),
             Path.Combine(ModuleDirectory, "Characters/Feats"),
-            Path.Combine(ModuleDirectory, "Characters/Skills")
+            Path.Combine(ModuleDirectory, "Characters/Rules"),
+            Path.Combine(ModuleDirectory, "Characters/Skills"),
+            Path.Combine(ModuleDirectory, "Logging")
         ]);
         
         
@@ -3,6 +3,8 @@
 #include "SurvivingGloomspire.h"
 #include "HAL/PlatformMisc.h"
 #include "Misc/OutputDeviceRedirector.h"  // Needed for GLog
+#include "SGDisplayNames.h"
+#include "SGTrace.h"
 
 IMPLEMENT_PRIMARY_GAME_MODULE(FSurvivingGloomspireModule, SurvivingGloomspire, "SurvivingGloomspire");
 
@@ -10,7 +12,6 @@ IMPLEMENT_PRIMARY_GAME_MODULE(FSurvivingGloomspireModule, SurvivingGloomspire, "
 
 void FSurvivingGloomspireModule::StartupModule()
 {
-    \
     // Register any module-specific settings here
     // RegisterSettings();
     
@@ -18,14 +19,15 @@ void FSurvivingGloomspireModule::StartupModule()
     // RegisterAssetTypes();
     
     // Initialize any module-specific systems here
-    // InitializeSystems();
+    FSGDisplayNames::Initialize();
+    FSGTrace::Initialize();
 }
 
 void FSurvivingGloomspireModule::ShutdownModule()
 {
-    
     // Shutdown any module-specific systems here
-    // ShutdownSystems();
+    FSGTrace::Shutdown();
+    FSGDisplayNames::Shutdown();
     
     // Unregister any module-specific asset types here
     // UnregisterAssetTypes();
@@ -0,0 +1,109 @@
+// Copyright 2025 Surviving Gloomspire Team. All Rights Reserved.
+
+#include "SGDiceStream.h"
+#include "SGDiceSubsystem.h"
+#include "Engine/GameInstance.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace SGDiceStreamTest
+{
+    constexpr int32 NumRolls = 256;
+
+    TArray<int32> RollD20s(FSGDiceStream& Stream)
+    {
+        TArray<int32> Rolls;
+        Rolls.Reserve(NumRolls);
+        for (int32 Index = 0; Index < NumRolls; ++Index)
+        {
+            Rolls.Add(Stream.RollD20());
+        }
+        return Rolls;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSGDiceStreamDeterminismTest, "Game.Rules.Dice.StreamDeterminism",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+bool FSGDiceStreamDeterminismTest::RunTest(const FString& Parameters)
+{
+    using namespace SGDiceStreamTest;
+
+    FSGDiceStream First = FSGDiceStream::Make(42, 3, 7, ESGDicePurpose::AttackRoll);
+    FSGDiceStream Second = FSGDiceStream::Make(42, 3, 7, ESGDicePurpose::AttackRoll);
+    const TArray<int32> FirstRolls = RollD20s(First);
+    TestEqual(TEXT("The same seed and stream ID give the same rolls"), RollD20s(Second), FirstRolls);
+
+    for (const int32 Roll : FirstRolls)
+    {
+        if (!TestTrue(TEXT("Every d20 is in [1, 20]"), Roll >= 1 && Roll <= 20))
+        {
+            break;
+        }
+    }
+
+    FSGDiceStream OtherRoller = FSGDiceStream::Make(42, 3, 8, ESGDicePurpose::AttackRoll);
+    FSGDiceStream OtherPurpose = FSGDiceStream::Make(42, 3, 7, ESGDicePurpose::Damage);
+    TestNotEqual(TEXT("Another stream ID gives different rolls"), RollD20s(OtherRoller), FirstRolls);
+    TestNotEqual(TEXT("Another purpose gives different rolls"), RollD20s(OtherPurpose), FirstRolls);
+
+    // A saved stream continues exactly where the original left off
+    FSGDiceStream Original = FSGDiceStream::Make(42, 3, 7, ESGDicePurpose::AttackRoll);
+    Original.Skip(NumRolls / 2);
+    FSGDiceStream Restored(Original.GetKey(), Original.GetCounter());
+    TestEqual(TEXT("A restored stream continues the original sequence"), RollD20s(Restored), RollD20s(Original));
+
+    // Batched rolls match rolling one at a time
+    FSGDiceStream Batched = FSGDiceStream::Make(42, 3, 7, ESGDicePurpose::AttackRoll);
+    TArray<int32> BatchedRolls;
+    BatchedRolls.SetNumUninitialized(NumRolls);
+    Batched.RollD20s(BatchedRolls);
+    TestEqual(TEXT("RollD20s matches RollD20"), BatchedRolls, FirstRolls);
+    TestEqual(TEXT("RollD20s advances the counter"), Batched.GetCounter(), uint64(NumRolls));
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSGDiceSubsystemRollerIdTest, "Game.Rules.Dice.RollerIds",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+bool FSGDiceSubsystemRollerIdTest::RunTest(const FString& Parameters)
+{
+    using namespace SGDiceStreamTest;
+
+    // Game instance subsystems must be outered to a game instance
+    USGDiceSubsystem* FirstSession = NewObject<USGDiceSubsystem>(NewObject<UGameInstance>(GetTransientPackage()));
+    USGDiceSubsystem* SecondSession = NewObject<USGDiceSubsystem>(NewObject<UGameInstance>(GetTransientPackage()));
+    UObject* FirstRoller = NewObject<UObject>(GetTransientPackage());
+    UObject* SecondRoller = NewObject<UObject>(GetTransientPackage());
+
+    FirstSession->SetSeed(42);
+    SecondSession->SetSeed(42);
+    FirstSession->BeginEncounter(3);
+    SecondSession->BeginEncounter(3);
+
+    const uint32 RollerId = FirstSession->GetRollerId(FirstRoller);
+    TestNotEqual(TEXT("Rollers are assigned an identifier"), RollerId, 0u);
+    TestEqual(TEXT("A roller keeps its identifier"), FirstSession->GetRollerId(FirstRoller), RollerId);
+    TestNotEqual(TEXT("Rollers get distinct identifiers"), FirstSession->GetRollerId(SecondRoller), RollerId);
+    TestEqual(TEXT("A null roller has no identifier"), FirstSession->GetRollerId(nullptr), 0u);
+
+    // Identifiers come from the order of first rolls, not from object names
+    TArray<int32> FirstRolls;
+    TArray<int32> SecondRolls;
+    for (int32 Index = 0; Index < NumRolls; ++Index)
+    {
+        FirstRolls.Add(FirstSession->RollD20(FirstRoller, ESGDicePurpose::SkillCheck));
+        SecondRolls.Add(SecondSession->RollD20(SecondRoller, ESGDicePurpose::SkillCheck));
+    }
+    TestEqual(TEXT("The same seed and roller identifier give the same rolls"), SecondRolls, FirstRolls);
+
+    const FSGDiceState State = FirstSession->SaveState();
+    TestEqual(TEXT("The saved state keeps the next roller identifier"), State.NextRollerId, RollerId + 2);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
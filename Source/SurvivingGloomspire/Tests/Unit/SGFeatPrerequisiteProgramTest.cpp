@@ -0,0 +1,103 @@
+// Copyright 2025 Surviving Gloomspire Team. All Rights Reserved.
+
+#include "SGFeatPrerequisiteProgram.h"
+#include "SGFeatPrerequisite.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSGFeatPrerequisiteCompileTest, "Game.Feats.Prerequisites.Compile",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+bool FSGFeatPrerequisiteCompileTest::RunTest(const FString& Parameters)
+{
+    ESGAttributeType Attribute = ESGAttributeType::MAX;
+    TestTrue(TEXT("Attributes resolve by entry name"), SGFeatPrerequisites::ResolveAttribute(TEXT("str"), Attribute) && Attribute == ESGAttributeType::STR);
+    TestTrue(TEXT("Attributes resolve by display name"), SGFeatPrerequisites::ResolveAttribute(TEXT("Dexterity"), Attribute) && Attribute == ESGAttributeType::DEX);
+
+    ESGSkillType Skill = ESGSkillType::Acrobatics;
+    TestTrue(TEXT("Skills resolve by entry name"), SGFeatPrerequisites::ResolveSkill(TEXT("KnowledgeArcana"), Skill) && Skill == ESGSkillType::KnowledgeArcana);
+    Skill = ESGSkillType::Acrobatics;
+    TestTrue(TEXT("Skills resolve by display name"), SGFeatPrerequisites::ResolveSkill(TEXT("Knowledge (Arcana)"), Skill) && Skill == ESGSkillType::KnowledgeArcana);
+
+    ESGClassType Class = ESGClassType::None;
+    TestTrue(TEXT("Classes resolve by name"), SGFeatPrerequisites::ResolveClass(TEXT("Fighter"), Class) && Class == ESGClassType::Fighter);
+    TestFalse(TEXT("None is not a class"), SGFeatPrerequisites::ResolveClass(TEXT("None"), Class));
+
+    ESGFeatType Feat = ESGFeatType::MAX;
+    TestTrue(TEXT("Feats resolve by entry name"), SGFeatPrerequisites::ResolveFeat(TEXT("Dodge"), Feat) && Feat == ESGFeatType::Dodge);
+    TestFalse(TEXT("Unknown names do not resolve"), SGFeatPrerequisites::ResolveAttribute(TEXT("Strenght"), Attribute));
+    TestFalse(TEXT("Empty names do not resolve"), SGFeatPrerequisites::ResolveSkill(NAME_None, Skill));
+
+    const FSGFeatPrerequisite Prerequisites[] =
+    {
+        FSGFeatPrerequisite(ESGFeatPrerequisiteType::Attribute, 13, TEXT("Strength")),
+        FSGFeatPrerequisite(ESGFeatPrerequisiteType::SkillRank, 4, TEXT("Knowledge (Arcana)")),
+        FSGFeatPrerequisite(ESGFeatPrerequisiteType::BaseAttackBonus, 1),
+        FSGFeatPrerequisite(ESGFeatPrerequisiteType::ClassLevel, 4, TEXT("Fighter")),
+        FSGFeatPrerequisite(ESGFeatPrerequisiteType::Feat, 0, TEXT("Dodge")),
+        FSGFeatPrerequisite(ESGFeatPrerequisiteType::None),
+    };
+
+    FSGPrerequisiteProgram Program;
+    TArray<FText> Errors;
+    TestTrue(TEXT("Known prerequisites compile"), SGFeatPrerequisites::Compile(Prerequisites, Program, &Errors));
+    TestEqual(TEXT("No errors for known prerequisites"), Errors.Num(), 0);
+    TestEqual(TEXT("Feat prerequisites fold into the mask"), Program.RequiredFeatMask, SGFeats::Bit(ESGFeatType::Dodge));
+    TestEqual(TEXT("One instruction per non-feat prerequisite"), Program.Instructions.Num(), 4);
+
+    FSGCharacterSnapshot Snapshot;
+    Snapshot.AttributeScores[static_cast<int32>(ESGAttributeType::STR)] = 13;
+    Snapshot.SkillRanks[static_cast<int32>(ESGSkillType::KnowledgeArcana)] = 4;
+    Snapshot.BaseAttackBonus = 4;
+    Snapshot.ClassLevels[static_cast<int32>(ESGClassType::Fighter)] = 4;
+    Snapshot.OwnedFeatMask = SGFeats::Bit(ESGFeatType::Dodge);
+    TestTrue(TEXT("A character meeting every prerequisite passes"), Program.Evaluate(Snapshot));
+
+    FSGCharacterSnapshot Weaker = Snapshot;
+    Weaker.AttributeScores[static_cast<int32>(ESGAttributeType::STR)] = 12;
+    TestFalse(TEXT("A low attribute fails"), Program.Evaluate(Weaker));
+
+    FSGCharacterSnapshot WithoutFeat = Snapshot;
+    WithoutFeat.OwnedFeatMask = 0;
+    TestFalse(TEXT("A missing feat fails"), Program.Evaluate(WithoutFeat));
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSGFeatPrerequisiteUnknownTest, "Game.Feats.Prerequisites.UnknownNamesFail",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+bool FSGFeatPrerequisiteUnknownTest::RunTest(const FString& Parameters)
+{
+    const FSGFeatPrerequisite Prerequisites[] =
+    {
+        FSGFeatPrerequisite(ESGFeatPrerequisiteType::Level, 1),
+        FSGFeatPrerequisite(ESGFeatPrerequisiteType::Attribute, 13, TEXT("Strenght")),
+        FSGFeatPrerequisite(ESGFeatPrerequisiteType::Feat, 0, TEXT("NotAFeat")),
+        FSGFeatPrerequisite(ESGFeatPrerequisiteType::Race, 0, TEXT("Elf")),
+    };
+
+    FSGPrerequisiteProgram Program;
+    TArray<FText> Errors;
+    TestFalse(TEXT("Unknown names fail to compile"), SGFeatPrerequisites::Compile(Prerequisites, Program, &Errors));
+    TestEqual(TEXT("One error per prerequisite that did not compile"), Errors.Num(), 3);
+    TestEqual(TEXT("Every prerequisite still produces an instruction"), Program.Instructions.Num(), 4);
+
+    int32 NumFail = 0;
+    for (const FSGPrerequisiteInstruction& Instruction : Program.Instructions)
+    {
+        NumFail += Instruction.Op == ESGPrerequisiteOp::Fail ? 1 : 0;
+    }
+    TestEqual(TEXT("Prerequisites that did not compile become Fail"), NumFail, 3);
+
+    FSGCharacterSnapshot Snapshot;
+    Snapshot.TotalLevel = 20;
+    FMemory::Memset(Snapshot.AttributeScores, 0x7F, sizeof(Snapshot.AttributeScores));
+    Snapshot.OwnedFeatMask = ~uint64(0);
+    TestFalse(TEXT("A program with Fail instructions is never met"), Program.Evaluate(Snapshot));
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
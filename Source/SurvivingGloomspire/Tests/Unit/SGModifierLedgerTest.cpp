@@ -0,0 +1,157 @@
+// Copyright 2025 Surviving Gloomspire Team. All Rights Reserved.
+
+#include "SGModifierLedger.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace SGModifierLedgerTest
+{
+    constexpr int32 ArmorClass = SGModifiers::GetSlot(ESGModifierTarget::ArmorClass);
+    constexpr int32 Stealth = SGModifiers::SkillSlot(ESGSkillType::Stealth);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSGModifierLedgerTypedStackingTest, "Game.Attributes.ModifierLedger.TypedStacking",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+bool FSGModifierLedgerTypedStackingTest::RunTest(const FString& Parameters)
+{
+    using namespace SGModifierLedgerTest;
+    FSGModifierLedger Ledger;
+
+    const FSGModifierHandle Ring = Ledger.Add(TEXT("Ring"), ESGBonusType::Deflection, ArmorClass, 2);
+    const FSGModifierHandle Spell = Ledger.Add(TEXT("Spell"), ESGBonusType::Deflection, ArmorClass, 4);
+    Ledger.Add(TEXT("Armor"), ESGBonusType::Armor, ArmorClass, 5);
+    TestEqual(TEXT("Only the highest deflection bonus applies"), Ledger.GetTypedBonus(ArmorClass, ESGBonusType::Deflection), 4);
+    TestEqual(TEXT("Different types stack"), Ledger.GetTotal(ArmorClass), 9);
+
+    Ledger.Add(TEXT("Curse"), ESGBonusType::Deflection, ArmorClass, -1);
+    TestEqual(TEXT("Penalties stack with the highest bonus"), Ledger.GetTypedTotal(ArmorClass, ESGBonusType::Deflection), 3);
+    TestEqual(TEXT("Typed bonus ignores penalties"), Ledger.GetTypedBonus(ArmorClass, ESGBonusType::Deflection), 4);
+
+    TestTrue(TEXT("Removing the highest bonus succeeds"), Ledger.Remove(Spell));
+    TestEqual(TEXT("The next highest bonus applies after removing the highest"), Ledger.GetTotal(ArmorClass), 6);
+    TestFalse(TEXT("A handle cannot be removed twice"), Ledger.Remove(Spell));
+
+    TestTrue(TEXT("Removing the last bonus succeeds"), Ledger.Remove(Ring));
+    TestEqual(TEXT("Only the penalty remains"), Ledger.GetTypedTotal(ArmorClass, ESGBonusType::Deflection), -1);
+    TestTrue(TEXT("The slot is marked changed"), (Ledger.ConsumeChangedSlots() & SGModifiers::SlotBit(ArmorClass)) != 0);
+    TestEqual(TEXT("Changed slots are cleared once consumed"), Ledger.ConsumeChangedSlots(), uint64(0));
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSGModifierLedgerStackingSourcesTest, "Game.Attributes.ModifierLedger.StackingSources",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+bool FSGModifierLedgerStackingSourcesTest::RunTest(const FString& Parameters)
+{
+    using namespace SGModifierLedgerTest;
+    FSGModifierLedger Ledger;
+
+    // Dodge bonuses stack, but not two from the same source
+    Ledger.Add(TEXT("Dodge"), ESGBonusType::Dodge, ArmorClass, 1);
+    const FSGModifierHandle Haste = Ledger.Add(TEXT("Haste"), ESGBonusType::Dodge, ArmorClass, 1);
+    const FSGModifierHandle HasteAgain = Ledger.Add(TEXT("Haste"), ESGBonusType::Dodge, ArmorClass, 2);
+    TestEqual(TEXT("Same-source dodge bonuses do not stack"), Ledger.GetTotal(ArmorClass), 3);
+
+    Ledger.Remove(HasteAgain);
+    TestEqual(TEXT("The source's next bonus applies after removing its highest"), Ledger.GetTotal(ArmorClass), 2);
+    Ledger.Remove(Haste);
+    TestEqual(TEXT("Removing a source's last bonus removes its contribution"), Ledger.GetTotal(ArmorClass), 1);
+
+    // Untyped bonuses without a source each stack
+    Ledger.Add(NAME_None, ESGBonusType::Untyped, Stealth, 2);
+    Ledger.Add(NAME_None, ESGBonusType::Untyped, Stealth, 2);
+    Ledger.Add(TEXT("Cloak"), ESGBonusType::Untyped, Stealth, 3);
+    Ledger.Add(TEXT("Cloak"), ESGBonusType::Untyped, Stealth, 1);
+    TestEqual(TEXT("Unnamed untyped bonuses stack and named ones keep their highest"), Ledger.GetTotal(Stealth), 7);
+
+    Ledger.Add(TEXT("Cloak"), ESGBonusType::Competence, Stealth, 2);
+    Ledger.Add(TEXT("Cloak"), ESGBonusType::Untyped, Stealth, -2);
+    TestEqual(TEXT("RemoveAllFromSource reports every modifier from the source"), Ledger.RemoveAllFromSource(TEXT("Cloak")), 4);
+    TestEqual(TEXT("RemoveAllFromSource leaves other sources"), Ledger.GetTotal(Stealth), 4);
+    TestEqual(TEXT("RemoveAllFromSource ignores unknown sources"), Ledger.RemoveAllFromSource(TEXT("Cloak")), 0);
+    TestEqual(TEXT("RemoveAllFromSource leaves other slots"), Ledger.GetTotal(ArmorClass), 1);
+    TestEqual(TEXT("Active modifier count"), Ledger.Num(), 3);
+
+    Ledger.Reset();
+    TestEqual(TEXT("Reset clears totals"), Ledger.GetTotal(Stealth), 0);
+    TestEqual(TEXT("Reset clears modifiers"), Ledger.Num(), 0);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSGModifierLedgerRandomRemovalTest, "Game.Attributes.ModifierLedger.RandomRemoval",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+bool FSGModifierLedgerRandomRemovalTest::RunTest(const FString& Parameters)
+{
+    using namespace SGModifierLedgerTest;
+    FSGModifierLedger Ledger;
+    FRandomStream Random(1234);
+
+    struct FAdded
+    {
+        FSGModifierHandle Handle;
+        FName Source;
+        ESGBonusType BonusType;
+        int32 Value;
+    };
+
+    const FName Sources[] = { TEXT("A"), TEXT("B"), TEXT("C") };
+    const ESGBonusType BonusTypes[] = { ESGBonusType::Enhancement, ESGBonusType::Dodge };
+
+    TArray<FAdded> Added;
+    for (int32 Index = 0; Index < 64; ++Index)
+    {
+        FAdded& Modifier = Added.AddDefaulted_GetRef();
+        Modifier.Source = Sources[Random.RandHelper(UE_ARRAY_COUNT(Sources))];
+        Modifier.BonusType = BonusTypes[Random.RandHelper(UE_ARRAY_COUNT(BonusTypes))];
+        Modifier.Value = Random.RandRange(-3, 8);
+        Modifier.Handle = Ledger.Add(Modifier.Source, Modifier.BonusType, ArmorClass, Modifier.Value);
+    }
+
+    // Remove in random order, checking the cached total against a full recount after each removal
+    while (Added.Num() > 0)
+    {
+        const int32 RemoveIndex = Random.RandHelper(Added.Num());
+        Ledger.Remove(Added[RemoveIndex].Handle);
+        Added.RemoveAtSwap(RemoveIndex);
+
+        int32 Expected = 0;
+        int32 HighestEnhancement = 0;
+        TMap<FName, int32> HighestDodgeBySource;
+        for (const FAdded& Modifier : Added)
+        {
+            if (Modifier.Value < 0)
+            {
+                Expected += Modifier.Value;
+            }
+            else if (Modifier.BonusType == ESGBonusType::Enhancement)
+            {
+                HighestEnhancement = FMath::Max(HighestEnhancement, Modifier.Value);
+            }
+            else
+            {
+                int32& Highest = HighestDodgeBySource.FindOrAdd(Modifier.Source);
+                Highest = FMath::Max(Highest, Modifier.Value);
+            }
+        }
+        Expected += HighestEnhancement;
+        for (const TPair<FName, int32>& Pair : HighestDodgeBySource)
+        {
+            Expected += Pair.Value;
+        }
+
+        if (!TestEqual(FString::Printf(TEXT("Total with %d modifiers left"), Added.Num()), Ledger.GetTotal(ArmorClass), Expected))
+        {
+            break;
+        }
+    }
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS